@@ -1,30 +1,171 @@
 #include "KRollAPI.h"
 #include "KRollSubsystem.h"
 
-#include "Engine/Engine.h"
-#include "Engine/GameInstance.h"
+#include "CoreGlobals.h"
+#include "Misc/EngineVersionComparison.h"
 
+#include <atomic>
 
-class UKRollSubsystem* FKRollAPI::Resolve()
+namespace
 {
-	if (!GEngine)
-    {
-        return nullptr;
-    }
+// PIE instance ids are small and dense; later clients fall back to the default instance
+constexpr int32 MaxPIEInstances = 16;
 
-    const UWorld* World = GEngine->GetCurrentPlayWorld();
-    if (!World)
-    {
-        return nullptr;
-    }
+// Written only on (un)registration; a read is a single acquire load. A store that was ever
+// published here is kept alive until the module unloads (see RetiredStores), so no read has to
+// take a reference.
+std::atomic<const FKRollSnapshotStore*> DefaultSlot{nullptr};
+std::atomic<const FKRollSnapshotStore*> PIESlots[MaxPIEInstances] = {};
 
-    UGameInstance* GameInstance = World->GetGameInstance();
-    if (!GameInstance)
-    {
-        return nullptr;
-    }
+// Set by FScopedInstance, which holds the reference for as long as they are set
+thread_local const FKRollSnapshotStore* ScopedStore = nullptr;
+thread_local UKRollSubsystem* ScopedInstance = nullptr;
+
+// Game-thread state: registration order decides the next default
+struct FRegistration
+{
+	TWeakObjectPtr<UKRollSubsystem> Instance;
+	FKRollSnapshotStoreRef Store;
+	int32 PIEInstance = INDEX_NONE;
+};
+TArray<FRegistration> Registrations;
+
+// Stores of unregistered instances. Their owner resets them on shutdown, so each holds no snapshot.
+TArray<FKRollSnapshotStoreRef> RetiredStores;
+
+int32 GetCurrentPIEInstance()
+{
+#if WITH_EDITOR
+	// Set while the engine ticks a given PIE world; meaningless on other threads
+	if (GIsEditor && IsInGameThread())
+	{
+#if UE_VERSION_NEWER_THAN_OR_EQUAL(5, 5, 0)
+		return UE::GetPlayInEditorID();
+#else
+		return GPlayInEditorID;
+#endif
+	}
+#endif
+	return INDEX_NONE;
+}
+
+bool IsValidPIEInstance(int32 PIEInstance)
+{
+	return PIEInstance >= 0 && PIEInstance < MaxPIEInstances;
+}
+
+const FKRollSnapshotStore* LoadRegisteredStore()
+{
+	const int32 PIEInstance = GetCurrentPIEInstance();
+	if (IsValidPIEInstance(PIEInstance))
+	{
+		if (const FKRollSnapshotStore* Store = PIESlots[PIEInstance].load(std::memory_order_acquire))
+		{
+			return Store;
+		}
+	}
+	return DefaultSlot.load(std::memory_order_acquire);
+}
+}
+
+FKRollAPI::FScopedInstance::FScopedInstance(UKRollSubsystem* Instance)
+	: PreviousStore(ScopedStore)
+	, PreviousInstance(ScopedInstance)
+{
+	if (Instance)
+	{
+		Store = Instance->GetSharedSnapshotStore();
+	}
+	ScopedStore = Store.Get();
+	ScopedInstance = Instance;
+}
+
+FKRollAPI::FScopedInstance::FScopedInstance(const FKRollSnapshotStoreRef& InStore)
+	: Store(InStore)
+	, PreviousStore(ScopedStore)
+	, PreviousInstance(ScopedInstance)
+{
+	ScopedStore = Store.Get();
+	ScopedInstance = nullptr;
+}
+
+FKRollAPI::FScopedInstance::~FScopedInstance()
+{
+	ScopedStore = PreviousStore;
+	ScopedInstance = PreviousInstance;
+}
+
+UKRollSubsystem* FKRollAPI::Resolve()
+{
+	check(IsInGameThread());
+
+	if (UKRollSubsystem* Scoped = ScopedInstance)
+	{
+		return Scoped;
+	}
 
-    return GameInstance->GetSubsystem<UKRollSubsystem>();
+	const int32 PIEInstance = GetCurrentPIEInstance();
+	if (IsValidPIEInstance(PIEInstance))
+	{
+		for (const FRegistration& It : Registrations)
+		{
+			if (It.PIEInstance == PIEInstance)
+			{
+				return It.Instance.Get();
+			}
+		}
+	}
+
+	return Registrations.IsEmpty() ? nullptr : Registrations[0].Instance.Get();
+}
+
+void FKRollAPI::Register(UKRollSubsystem* Instance, int32 PIEInstance)
+{
+	check(IsInGameThread());
+
+	if (!Instance || Registrations.ContainsByPredicate([Instance](const FRegistration& It) { return It.Instance == Instance; }))
+	{
+		return;
+	}
+
+	const FKRollSnapshotStoreRef Store = Instance->GetSharedSnapshotStore();
+	Registrations.Add(FRegistration{ Instance, Store, IsValidPIEInstance(PIEInstance) ? PIEInstance : INDEX_NONE });
+
+	if (IsValidPIEInstance(PIEInstance))
+	{
+		PIESlots[PIEInstance].store(&Store.Get(), std::memory_order_release);
+	}
+	if (!DefaultSlot.load(std::memory_order_relaxed))
+	{
+		DefaultSlot.store(&Store.Get(), std::memory_order_release);
+	}
+}
+
+void FKRollAPI::Unregister(UKRollSubsystem* Instance)
+{
+	check(IsInGameThread());
+
+	const int32 Index = Registrations.IndexOfByPredicate([Instance](const FRegistration& It) { return It.Instance == Instance; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FRegistration Removed = Registrations[Index];
+	Registrations.RemoveAt(Index);
+
+	const FKRollSnapshotStore* RemovedStore = &Removed.Store.Get();
+	if (IsValidPIEInstance(Removed.PIEInstance) && PIESlots[Removed.PIEInstance].load(std::memory_order_relaxed) == RemovedStore)
+	{
+		PIESlots[Removed.PIEInstance].store(nullptr, std::memory_order_release);
+	}
+	if (DefaultSlot.load(std::memory_order_relaxed) == RemovedStore)
+	{
+		DefaultSlot.store(Registrations.IsEmpty() ? nullptr : &Registrations[0].Store.Get(), std::memory_order_release);
+	}
+
+	// A reader may have loaded the slot just before it was cleared
+	RetiredStores.Add(Removed.Store);
 }
 
 void FKRollAPI::FetchConfigs()
@@ -35,31 +176,93 @@ void FKRollAPI::FetchConfigs()
     }
 }
 
-bool FKRollAPI::GetBool(const FString& Key, bool DefaultValue)
+namespace
+{
+int32 FindSlot(const FKRollSnapshot& Snapshot, FUtf8StringView Key) { return Snapshot.FindIndex(Key); }
+int32 FindSlot(const FKRollSnapshot& Snapshot, FName Key) { return Snapshot.FindIndex(Key); }
+int32 FindSlot(const FKRollSnapshot& Snapshot, const FKRollKeyHandle& Key) { return Key.Resolve(Snapshot); }
+
+// Read(Snapshot, Slot) within one read scope of the current store; false without a snapshot
+template <typename KeyType, typename ReadFn>
+bool ReadSlot(const KeyType& Key, ReadFn&& Read)
+{
+	const FKRollSnapshotStore* Store = ScopedStore;
+	if (!Store)
+	{
+		Store = LoadRegisteredStore();
+	}
+	if (!Store)
+	{
+		return false;
+	}
+
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Read(*Snapshot.Get(), FindSlot(*Snapshot.Get(), Key));
+}
+
+template <typename KeyType>
+bool ReadBool(const KeyType& Key, bool DefaultValue)
 {
-    if (const UKRollSubsystem* S = Resolve())
-        return S->GetBool(Key, DefaultValue);
-    return DefaultValue;
+	bool Value = DefaultValue;
+	ReadSlot(Key, [&Value](const FKRollSnapshot& Snapshot, int32 Slot) { return Snapshot.TryGetBool(Slot, Value); });
+	return Value;
 }
 
-FString FKRollAPI::GetString(const FString& Key, const FString& DefaultValue)
+template <typename KeyType>
+double ReadNumber(const KeyType& Key, double DefaultValue)
 {
-    if (const UKRollSubsystem* S = Resolve())
-        return S->GetString(Key, DefaultValue);
-    return DefaultValue;
+	double Value = DefaultValue;
+	ReadSlot(Key, [&Value](const FKRollSnapshot& Snapshot, int32 Slot) { return Snapshot.TryGetNumber(Slot, Value); });
+	return Value;
 }
 
-double FKRollAPI::GetNumber(const FString& Key, double DefaultValue)
+template <typename KeyType>
+FString ReadString(const KeyType& Key, const FString& DefaultValue)
 {
-    if (const UKRollSubsystem* S = Resolve())
-        return S->GetNumber(Key, DefaultValue);
-    return DefaultValue;
+	FString Value;
+	const bool bFound = ReadSlot(Key, [&Value](const FKRollSnapshot& Snapshot, int32 Slot) { return Snapshot.TryGetString(Slot, Value); });
+	return bFound ? Value : DefaultValue;
 }
 
-TSharedPtr<FJsonValue> FKRollAPI::GetJson(const FString& Key)
+template <typename KeyType>
+TSharedPtr<FJsonValue> ReadJson(const KeyType& Key)
 {
-    if (const UKRollSubsystem* S = Resolve())
-        return S->GetJson(Key);
-    return nullptr;
+	TSharedPtr<FJsonValue> Value;
+	ReadSlot(Key, [&Value](const FKRollSnapshot& Snapshot, int32 Slot)
+	{
+		Value = Snapshot.GetJson(Slot);
+		return Value.IsValid();
+	});
+	return Value;
 }
+}
+
+// Keys are ASCII in practice, so the UTF-8 conversion is a copy into a stack buffer
+#define KROLL_UTF8_KEY(Key) FUtf8StringView(StringCast<UTF8CHAR>(Key).Get())
+
+bool FKRollAPI::GetBool(const FString& Key, bool DefaultValue) { return ReadBool(KROLL_UTF8_KEY(*Key), DefaultValue); }
+FString FKRollAPI::GetString(const FString& Key, const FString& DefaultValue) { return ReadString(KROLL_UTF8_KEY(*Key), DefaultValue); }
+double FKRollAPI::GetNumber(const FString& Key, double DefaultValue) { return ReadNumber(KROLL_UTF8_KEY(*Key), DefaultValue); }
+TSharedPtr<FJsonValue> FKRollAPI::GetJson(const FString& Key) { return ReadJson(KROLL_UTF8_KEY(*Key)); }
+
+bool FKRollAPI::GetBool(const TCHAR* Key, bool DefaultValue) { return ReadBool(KROLL_UTF8_KEY(Key), DefaultValue); }
+FString FKRollAPI::GetString(const TCHAR* Key, const FString& DefaultValue) { return ReadString(KROLL_UTF8_KEY(Key), DefaultValue); }
+double FKRollAPI::GetNumber(const TCHAR* Key, double DefaultValue) { return ReadNumber(KROLL_UTF8_KEY(Key), DefaultValue); }
+TSharedPtr<FJsonValue> FKRollAPI::GetJson(const TCHAR* Key) { return ReadJson(KROLL_UTF8_KEY(Key)); }
+
+bool FKRollAPI::GetBool(const ANSICHAR* Key, bool DefaultValue) { return ReadBool(KROLL_UTF8_KEY(Key), DefaultValue); }
+FString FKRollAPI::GetString(const ANSICHAR* Key, const FString& DefaultValue) { return ReadString(KROLL_UTF8_KEY(Key), DefaultValue); }
+double FKRollAPI::GetNumber(const ANSICHAR* Key, double DefaultValue) { return ReadNumber(KROLL_UTF8_KEY(Key), DefaultValue); }
+TSharedPtr<FJsonValue> FKRollAPI::GetJson(const ANSICHAR* Key) { return ReadJson(KROLL_UTF8_KEY(Key)); }
+
+#undef KROLL_UTF8_KEY
+
+bool FKRollAPI::GetBool(FName Key, bool DefaultValue) { return ReadBool(Key, DefaultValue); }
+FString FKRollAPI::GetString(FName Key, const FString& DefaultValue) { return ReadString(Key, DefaultValue); }
+double FKRollAPI::GetNumber(FName Key, double DefaultValue) { return ReadNumber(Key, DefaultValue); }
+TSharedPtr<FJsonValue> FKRollAPI::GetJson(FName Key) { return ReadJson(Key); }
 
+bool FKRollAPI::GetBool(const FKRollKeyHandle& Key, bool DefaultValue) { return ReadBool(Key, DefaultValue); }
+FString FKRollAPI::GetString(const FKRollKeyHandle& Key, const FString& DefaultValue) { return ReadString(Key, DefaultValue); }
+double FKRollAPI::GetNumber(const FKRollKeyHandle& Key, double DefaultValue) { return ReadNumber(Key, DefaultValue); }
+TSharedPtr<FJsonValue> FKRollAPI::GetJson(const FKRollKeyHandle& Key) { return ReadJson(Key); }
@@ -1,18 +1,54 @@
 #include "KRollBindingApplier.h"
 
 #include "KRollSubsystem.h"
+#include "KRollSnapshot.h"
 #include "KRollKeyResolver.h"
 #include "KRollLog.h"
 
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
 // GAS
 #include "AbilitySystemComponent.h"
 #include "AttributeSet.h"
+#include "GameplayEffect.h"
+#include "UObject/Package.h"
 
-namespace
+FName FKRollBindingApplier::ResolveBindingKey(const FKRollPropertyBinding& Binding, const UObject* KeyContext, const UObject* Target)
 {
-static constexpr int32 AttributeSetSeedPasses = 2;
+	// Templates without tokens skip resolution entirely
+	if (Binding.StaticKey.IsSet())
+	{
+		return Binding.StaticKey.GetKey();
+	}
 
-double ApplyTransformForBinding(double V, const FKRollTransform& T)
+	const FName ResolvedKey =
+		FKRollKeyResolver::ResolveKey(Binding.Template, Target, KeyContext ? KeyContext : Target);
+	if (ResolvedKey.IsNone())
+	{
+		// Templates are validated at cache build time; this is a token with no value for this target
+		const UClass* Owner = Target ? Target->GetClass() : nullptr;
+		const uint64 LogKey = FKRollLogOnce::MakeKey(Owner, Binding.Property, KROLL_REASON_UNRESOLVED_TOKEN);
+		if (FKRollLogOnce::ShouldLog(LogKey))
+		{
+			UE_LOG(LogKRoll, Warning,
+				   TEXT("KRoll: unresolved token in key template \"%s\" for %s.%s"),
+				   *Binding.KeyTemplate.ToString(),
+				   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
+				   Binding.Property ? *Binding.Property->GetName() : TEXT("UnknownProp"));
+		}
+	}
+	return ResolvedKey;
+}
+
+int32 FKRollBindingApplier::FindSlot(const FKRollSnapshot& Snapshot, const FKRollPropertyBinding& Binding, FName ResolvedKey)
+{
+	return Binding.StaticKey.IsSet() ? Binding.StaticKey.Resolve(Snapshot) : Snapshot.FindIndex(ResolvedKey);
+}
+
+namespace
+{
+double ApplyTransform(double V, const FKRollTransform& T)
 {
 	V *= T.Scale;
 
@@ -27,109 +63,744 @@ double ApplyTransformForBinding(double V, const FKRollTransform& T)
 	return V;
 }
 
-bool ResolveNumericBindingValue(
-	const FKRollPropertyBinding& Binding,
-	const UKRollSubsystem* KRollSubsystem,
-	const AActor* KeyContextActor,
-	const UObject* FallbackContext,
-	double& OutValue
-)
+// Color alpha is opacity, not a tuning value; Scale and clamps apply to RGB only
+FLinearColor ApplyColorTransform(double R, double G, double B, double A, const FKRollTransform& T)
+{
+	return FLinearColor(float(ApplyTransform(R, T)), float(ApplyTransform(G, T)), float(ApplyTransform(B, T)), float(A));
+}
+
+void WriteBoolBits(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue*)
+{
+	uint8& Byte = Container[W.Offset];
+	Byte = (Byte & ~W.FieldMask) | (W.BoolValue ? W.ByteMask : 0);
+}
+
+// Integers and enums of any width; the unsigned cast keeps the low bits
+template <typename T>
+void WriteInteger(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue*)
+{
+	*reinterpret_cast<T*>(Container + W.Offset) = static_cast<T>(W.IntValue);
+}
+
+void WriteFloat(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue*)
+{
+	*reinterpret_cast<float*>(Container + W.Offset) = W.FloatValue;
+}
+
+void WriteDouble(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue*)
 {
-	if (!Binding.Property || Binding.KeyTemplate.IsNone() || !KRollSubsystem || !KRollSubsystem->IsReady())
+	*reinterpret_cast<double*>(Container + W.Offset) = W.DoubleValue;
+}
+
+// Pooled values are parsed when the plan is built; the write is a copy assignment
+template <typename T>
+void WritePooled(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue* Values)
+{
+	*reinterpret_cast<T*>(Container + W.Offset) = Values[W.ValueIndex].Get<T>();
+}
+
+// One plan value is written to every target sharing the plan, so it cannot be moved out. Copy into
+// the target's existing buffer instead: only a value longer than the buffer ever allocates.
+template <>
+void WritePooled<FString>(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue* Values)
+{
+	FString& Dest = *reinterpret_cast<FString*>(Container + W.Offset);
+	const FString& Src = Values[W.ValueIndex].Get<FString>();
+	if (!Dest.Equals(Src, ESearchCase::CaseSensitive))
 	{
-		return false;
+		Dest.Reset(Src.Len());
+		Dest.Append(Src);
 	}
+}
 
-	const FName ResolvedKey =
-		FKRollKeyResolver::ResolveKey(
-			KeyContextActor ? static_cast<const UObject*>(KeyContextActor) : FallbackContext,
-			Binding.KeyTemplate
-	);
-	if (ResolvedKey.IsNone())
+template <>
+void WritePooled<TArray<float>>(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue* Values)
+{
+	TArray<float>& Dest = *reinterpret_cast<TArray<float>*>(Container + W.Offset);
+	const TArray<float>& Src = Values[W.ValueIndex].Get<TArray<float>>();
+	Dest.Reset(Src.Num());
+	Dest.Append(Src);
+}
+
+// DataTable-style seeding: write directly into the AttributeSet memory.
+// This bypasses ASC->SetNumericAttributeBase and therefore bypasses PreAttributeBaseChange clamps.
+void WriteAttributeData(uint8* Container, const FKRollPlanWrite& W, const FKRollPlanValue*)
+{
+	FGameplayAttributeData* Data = reinterpret_cast<FGameplayAttributeData*>(Container + W.Offset);
+	Data->SetBaseValue(W.FloatValue);
+	Data->SetCurrentValue(W.FloatValue);
+}
+
+FKRollWriteFn GetUnsignedWriter(int32 Size)
+{
+	switch (Size)
+	{
+		case 1: return &WriteInteger<uint8>;
+		case 2: return &WriteInteger<uint16>;
+		case 4: return &WriteInteger<uint32>;
+		case 8: return &WriteInteger<uint64>;
+		default: return nullptr;
+	}
+}
+
+bool IsStruct(const FProperty* Property, const UScriptStruct* Struct)
+{
+	const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	return StructProp && StructProp->Struct == Struct;
+}
+
+// Components from a JSON array (in order) or object (by field name, case-insensitive).
+// The first NumRequired components must be present; the others keep the value passed in.
+bool ReadComponents(const FJsonValue& Json, TConstArrayView<const TCHAR*> Names, int32 NumRequired, double* InOutValues)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+	if (Json.TryGetArray(Array))
+	{
+		if (Array->Num() < NumRequired || Array->Num() > Names.Num())
+		{
+			return false;
+		}
+		for (int32 Idx = 0; Idx < Array->Num(); ++Idx)
+		{
+			if (!(*Array)[Idx].IsValid() || !(*Array)[Idx]->TryGetNumber(InOutValues[Idx]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const TSharedPtr<FJsonObject>* Object = nullptr;
+	if (Json.TryGetObject(Object))
+	{
+		for (int32 Idx = 0; Idx < Names.Num(); ++Idx)
+		{
+			// FString map keys compare case-insensitively
+			const TSharedPtr<FJsonValue>* Field = (*Object)->Values.Find(Names[Idx]);
+			if (!Field || !Field->IsValid() || !(*Field)->TryGetNumber(InOutValues[Idx]))
+			{
+				if (Idx < NumRequired)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+bool ParseCompositeJson(EKRollValueKind Kind, const FJsonValue& Json, const FKRollTransform& T, FKRollPlanValue& Out)
+{
+	switch (Kind)
+	{
+		case EKRollValueKind::Vector:
+		{
+			static const TCHAR* Names[] = { TEXT("x"), TEXT("y"), TEXT("z") };
+			double V[3] = {};
+			if (!ReadComponents(Json, Names, 3, V))
+			{
+				return false;
+			}
+			Out.Emplace<FVector>(ApplyTransform(V[0], T), ApplyTransform(V[1], T), ApplyTransform(V[2], T));
+			return true;
+		}
+
+		case EKRollValueKind::Rotator:
+		{
+			static const TCHAR* Names[] = { TEXT("pitch"), TEXT("yaw"), TEXT("roll") };
+			double V[3] = {};
+			if (!ReadComponents(Json, Names, 3, V))
+			{
+				return false;
+			}
+			Out.Emplace<FRotator>(ApplyTransform(V[0], T), ApplyTransform(V[1], T), ApplyTransform(V[2], T));
+			return true;
+		}
+
+		case EKRollValueKind::LinearColor:
+		{
+			static const TCHAR* Names[] = { TEXT("r"), TEXT("g"), TEXT("b"), TEXT("a") };
+			double V[4] = { 0.0, 0.0, 0.0, 1.0 };
+			if (!ReadComponents(Json, Names, 3, V))
+			{
+				return false;
+			}
+			Out.Emplace<FLinearColor>(ApplyColorTransform(V[0], V[1], V[2], V[3], T));
+			return true;
+		}
+
+		case EKRollValueKind::FloatArray:
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+			if (!Json.TryGetArray(Array))
+			{
+				return false;
+			}
+
+			TArray<float> Floats;
+			Floats.Reserve(Array->Num());
+			for (const TSharedPtr<FJsonValue>& Element : *Array)
+			{
+				double Num = 0.0;
+				if (!Element.IsValid() || !Element->TryGetNumber(Num))
+				{
+					return false;
+				}
+				Floats.Add(float(ApplyTransform(Num, T)));
+			}
+			Out.Emplace<TArray<float>>(MoveTemp(Floats));
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
+
+bool ParseCompositeText(EKRollValueKind Kind, const FString& Text, const FKRollTransform& T, FKRollPlanValue& Out)
+{
+	const FString Trimmed = Text.TrimStartAndEnd();
+
+	// JSON written as a string (e.g. a KRollDefault of "[1, 2, 3]")
+	if (Trimmed.StartsWith(TEXT("[")) || Trimmed.StartsWith(TEXT("{")))
+	{
+		TSharedPtr<FJsonValue> Json;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Trimmed);
+		return FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+			&& ParseCompositeJson(Kind, *Json, T, Out);
+	}
+
+	switch (Kind)
+	{
+		case EKRollValueKind::Vector:
+		{
+			FVector V;
+			if (!V.InitFromString(Trimmed))
+			{
+				return false;
+			}
+			Out.Emplace<FVector>(ApplyTransform(V.X, T), ApplyTransform(V.Y, T), ApplyTransform(V.Z, T));
+			return true;
+		}
+
+		case EKRollValueKind::Rotator:
+		{
+			FRotator R;
+			if (!R.InitFromString(Trimmed))
+			{
+				return false;
+			}
+			Out.Emplace<FRotator>(ApplyTransform(R.Pitch, T), ApplyTransform(R.Yaw, T), ApplyTransform(R.Roll, T));
+			return true;
+		}
+
+		case EKRollValueKind::LinearColor:
+		{
+			FLinearColor C;
+			if (Trimmed.StartsWith(TEXT("#")))
+			{
+				// Hex colors are sRGB
+				C = FLinearColor(FColor::FromHex(Trimmed));
+			}
+			else if (!C.InitFromString(Trimmed))
+			{
+				return false;
+			}
+			Out.Emplace<FLinearColor>(ApplyColorTransform(C.R, C.G, C.B, C.A, T));
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
+
+// Adds an Override modifier for Property to Effect, creating the effect on first use. GAS only knows
+// attributes that are direct members of the set, not ones inside a struct scope.
+bool AddSeedModifier(UGameplayEffect*& Effect, FProperty* Property, float Value)
+{
+	if (!Property)
 	{
 		return false;
 	}
 
-	const FString KeyStr = ResolvedKey.ToString();
-	if (KeyStr.Contains(TEXT("{")))
+	if (!Property->GetOwner<UClass>())
 	{
-		const UClass* Owner = FallbackContext ? FallbackContext->GetClass() : nullptr;
-		const uint64 LogKey = FKRollLogOnce::MakeKey(Owner, Binding.Property, KROLL_REASON_UNRESOLVED_TOKEN);
+		const uint64 LogKey = FKRollLogOnce::MakeKey(nullptr, Property, KROLL_REASON_NESTED_ATTRIBUTE);
 		if (FKRollLogOnce::ShouldLog(LogKey))
 		{
 			UE_LOG(LogKRoll, Warning,
-				   TEXT("KRoll: unresolved token in key template \"%s\" for %s.%s -> \"%s\""),
-				   *Binding.KeyTemplate.ToString(),
-				   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
-				   Binding.Property ? *Binding.Property->GetName() : TEXT("UnknownProp"),
-				   *KeyStr);
+				   TEXT("KRoll: %s is not a direct attribute set member and cannot be seeded by GameplayEffect"),
+				   *Property->GetPathName());
 		}
 		return false;
 	}
 
-	double Num = 0.0;
-	const bool bFound = KRollSubsystem->GetNumber(ResolvedKey, Num);
-	if (!bFound)
+	if (!Effect)
 	{
-		if (!Binding.Transform.DefaultValue.IsSet())
-		{
-			return false;
-		}
-		Num = *Binding.Transform.DefaultValue;
+		Effect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+		Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
 	}
 
-	OutValue = ApplyTransformForBinding(Num, Binding.Transform);
+	FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = FGameplayAttribute(Property);
+	Modifier.ModifierOp = EGameplayModOp::Override;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(Value));
 	return true;
 }
 }
 
-bool FKRollBindingApplier::ReadBool(const UKRollSubsystem* KRoll, FName Key, bool& Out)
+FKRollPropertyWriter FKRollBindingApplier::CompileWriter(const FProperty* Property, EKRollValueKind Kind)
 {
-	return KRoll && KRoll->IsReady() && KRoll->GetBool(Key, Out);
-}
+	FKRollPropertyWriter Writer;
+	if (!Property)
+	{
+		return Writer;
+	}
 
-bool FKRollBindingApplier::ReadNumber(const UKRollSubsystem* KRoll, FName Key, double& Out)
-{
-	return KRoll && KRoll->IsReady() && KRoll->GetNumber(Key, Out);
+	Writer.Offset = uint32(Property->GetOffset_ForInternal());
+
+	switch (Kind)
+	{
+		case EKRollValueKind::Bool:
+			if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+			{
+				Writer.Offset += BoolProp->GetByteOffset();
+				Writer.FieldMask = BoolProp->GetFieldMask();
+				Writer.ByteMask = BoolProp->GetByteMask();
+				Writer.Write = &WriteBoolBits;
+			}
+			break;
+
+		case EKRollValueKind::Int32:
+			if (CastField<FIntProperty>(Property))
+			{
+				Writer.Write = &WriteInteger<int32>;
+			}
+			break;
+
+		case EKRollValueKind::Int64:
+			if (CastField<FInt64Property>(Property))
+			{
+				Writer.Write = &WriteInteger<int64>;
+			}
+			break;
+
+		case EKRollValueKind::Byte:
+			if (CastField<FByteProperty>(Property))
+			{
+				Writer.Write = &WriteInteger<uint8>;
+			}
+			break;
+
+		case EKRollValueKind::Enum:
+			if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+			{
+				const FNumericProperty* Underlying = EnumProp->GetUnderlyingProperty();
+				Writer.Write = Underlying ? GetUnsignedWriter(Underlying->ElementSize) : nullptr;
+			}
+			else if (CastField<FByteProperty>(Property))
+			{
+				// TEnumAsByte
+				Writer.Write = &WriteInteger<uint8>;
+			}
+			break;
+
+		case EKRollValueKind::Float:
+			if (CastField<FFloatProperty>(Property))
+			{
+				Writer.Write = &WriteFloat;
+			}
+			break;
+
+		case EKRollValueKind::Double:
+			if (CastField<FDoubleProperty>(Property))
+			{
+				Writer.Write = &WriteDouble;
+			}
+			break;
+
+		case EKRollValueKind::Name:
+			if (CastField<FNameProperty>(Property))
+			{
+				Writer.Write = &WritePooled<FName>;
+			}
+			break;
+
+		case EKRollValueKind::String:
+			if (CastField<FStrProperty>(Property))
+			{
+				Writer.Write = &WritePooled<FString>;
+			}
+			break;
+
+		case EKRollValueKind::Vector:
+			if (IsStruct(Property, TBaseStructure<FVector>::Get()))
+			{
+				Writer.Write = &WritePooled<FVector>;
+			}
+			break;
+
+		case EKRollValueKind::Rotator:
+			if (IsStruct(Property, TBaseStructure<FRotator>::Get()))
+			{
+				Writer.Write = &WritePooled<FRotator>;
+			}
+			break;
+
+		case EKRollValueKind::LinearColor:
+			if (IsStruct(Property, TBaseStructure<FLinearColor>::Get()))
+			{
+				Writer.Write = &WritePooled<FLinearColor>;
+			}
+			break;
+
+		case EKRollValueKind::FloatArray:
+		{
+			const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property);
+			if (ArrayProp && CastField<FFloatProperty>(ArrayProp->Inner))
+			{
+				Writer.Write = &WritePooled<TArray<float>>;
+			}
+			break;
+		}
+
+		case EKRollValueKind::GameplayAttributeData:
+			if (IsStruct(Property, TBaseStructure<FGameplayAttributeData>::Get()))
+			{
+				Writer.Write = &WriteAttributeData;
+			}
+			break;
+
+		default:
+			break;
+	}
+	return Writer;
 }
 
-double FKRollBindingApplier::ApplyTransform(double V, const FKRollTransform& T)
+bool FKRollBindingApplier::CompileDefault(FKRollPropertyBinding& B)
 {
-	V *= T.Scale;
+	FKRollTransform& T = B.Transform;
+	T.DefaultValue.Reset();
+	if (!T.DefaultText.IsSet())
+	{
+		return true;
+	}
 
-	if (T.ClampMin.IsSet())
+	const FString Text = T.DefaultText->TrimStartAndEnd();
+	bool bValid = false;
+
+	switch (B.Kind)
 	{
-		V = FMath::Max(V, *T.ClampMin);
+		case EKRollValueKind::Bool:
+		{
+			double Num = 0.0;
+			if (Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Text.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+			{
+				T.DefaultValue = Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) ? 1.0 : 0.0;
+				bValid = true;
+			}
+			else if (LexTryParseString(Num, *Text))
+			{
+				T.DefaultValue = Num != 0.0 ? 1.0 : 0.0;
+				bValid = true;
+			}
+			break;
+		}
+
+		case EKRollValueKind::Enum:
+		{
+			// Resolved to the value once, so plans never look the name up again
+			int64 Value = B.Enum ? B.Enum->GetValueByNameString(Text) : INDEX_NONE;
+			if (Value == INDEX_NONE && B.Enum && LexTryParseString(Value, *Text) && !B.Enum->IsValidEnumValue(Value))
+			{
+				Value = INDEX_NONE;
+			}
+			if (Value != INDEX_NONE)
+			{
+				T.DefaultValue = double(Value);
+				bValid = true;
+			}
+			break;
+		}
+
+		case EKRollValueKind::Name:
+		case EKRollValueKind::String:
+			bValid = true;
+			break;
+
+		case EKRollValueKind::Vector:
+		case EKRollValueKind::Rotator:
+		case EKRollValueKind::LinearColor:
+		case EKRollValueKind::FloatArray:
+		{
+			// Kept as text and parsed per plan, like a string value; checked here once
+			FKRollPlanValue Parsed;
+			bValid = ParseCompositeText(B.Kind, Text, T, Parsed);
+			break;
+		}
+
+		default:
+		{
+			double Num = 0.0;
+			if (LexTryParseString(Num, *Text))
+			{
+				T.DefaultValue = Num;
+				bValid = true;
+			}
+			break;
+		}
 	}
-	if (T.ClampMax.IsSet())
+
+	if (!bValid)
 	{
-		V = FMath::Min(V, *T.ClampMax);
+		T.DefaultText.Reset();
 	}
-	return V;
+	return bValid;
 }
 
-void FKRollBindingApplier::WriteBool(FProperty* Prop, void* Container, bool V)
+bool FKRollBindingApplier::ResolveWrite(
+	const FKRollSnapshot& Snapshot,
+	const FKRollPropertyBinding& B,
+	FName ResolvedKey,
+	FKRollPlanWrite& Out,
+	TArray<FKRollPlanValue>& OutValues
+)
 {
-	if (FBoolProperty* BP = CastField<FBoolProperty>(Prop))
+	Out.Write = B.Writer.Write;
+	Out.Offset = B.Writer.Offset;
+	Out.FieldMask = B.Writer.FieldMask;
+	Out.ByteMask = B.Writer.ByteMask;
+	Out.Kind = B.Kind;
+
+	const int32 Slot = FindSlot(Snapshot, B, ResolvedKey);
+
+	switch (B.Kind)
+	{
+		case EKRollValueKind::Bool:
+		{
+			bool V = false;
+			if (!Snapshot.TryGetBool(Slot, V))
+			{
+				if (!B.Transform.DefaultValue.IsSet())
+				{
+					return false;
+				}
+				V = (*B.Transform.DefaultValue != 0.0);
+			}
+			Out.BoolValue = V;
+			return true;
+		}
+
+		case EKRollValueKind::Int64:
+		{
+			// Exact when untransformed; doubles only hold 53 bits
+			int64 Int = 0;
+			const FKRollTransform& T = B.Transform;
+			if (T.Scale == 1.0 && !T.ClampMin.IsSet() && !T.ClampMax.IsSet() && Snapshot.TryGetInteger(Slot, Int))
+			{
+				Out.IntValue = Int;
+				return true;
+			}
+			break;
+		}
+
+		case EKRollValueKind::Enum:
+			return ResolveEnum(Snapshot, Slot, B, Out);
+
+		case EKRollValueKind::Name:
+		case EKRollValueKind::String:
+		{
+			FString Text;
+			if (!Snapshot.TryGetString(Slot, Text))
+			{
+				if (!B.Transform.DefaultText.IsSet())
+				{
+					return false;
+				}
+				Text = *B.Transform.DefaultText;
+			}
+
+			Out.ValueIndex = B.Kind == EKRollValueKind::Name
+				? OutValues.Emplace(TInPlaceType<FName>(), FName(*Text))
+				: OutValues.Emplace(TInPlaceType<FString>(), MoveTemp(Text));
+			return true;
+		}
+
+		case EKRollValueKind::Vector:
+		case EKRollValueKind::Rotator:
+		case EKRollValueKind::LinearColor:
+		case EKRollValueKind::FloatArray:
+		{
+			FKRollPlanValue Value;
+			bool bParsed = false;
+			const bool bPresent = Snapshot.IsValidIndex(Slot);
+
+			const EJson Type = Snapshot.GetType(Slot);
+			FString Text;
+			if (Type == EJson::Array || Type == EJson::Object)
+			{
+				const TSharedPtr<FJsonValue> Json = Snapshot.GetJson(Slot);
+				bParsed = Json.IsValid() && ParseCompositeJson(B.Kind, *Json, B.Transform, Value);
+			}
+			else if (Snapshot.TryGetString(Slot, Text))
+			{
+				bParsed = ParseCompositeText(B.Kind, Text, B.Transform, Value);
+			}
+
+			if (!bParsed && bPresent)
+			{
+				const UClass* Owner = B.Property ? B.Property->GetOwnerClass() : nullptr;
+				const uint64 LogKey = FKRollLogOnce::MakeKey(Owner, B.Property, KROLL_REASON_BAD_VALUE);
+				if (FKRollLogOnce::ShouldLog(LogKey))
+				{
+					UE_LOG(LogKRoll, Warning,
+						   TEXT("KRoll: value of \"%s\" does not fit %s.%s"),
+						   *ResolvedKey.ToString(),
+						   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
+						   B.Property ? *B.Property->GetName() : TEXT("UnknownProp"));
+				}
+			}
+
+			if (!bParsed && B.Transform.DefaultText.IsSet())
+			{
+				bParsed = ParseCompositeText(B.Kind, *B.Transform.DefaultText, B.Transform, Value);
+			}
+			if (!bParsed)
+			{
+				return false;
+			}
+
+			Out.ValueIndex = OutValues.Add(MoveTemp(Value));
+			return true;
+		}
+
+		default:
+			break;
+	}
+
+	// Numeric kinds
+	double Num = 0.0;
+	if (!Snapshot.TryGetNumber(Slot, Num))
+	{
+		if (!B.Transform.DefaultValue.IsSet())
+		{
+			return false;
+		}
+		Num = *B.Transform.DefaultValue;
+	}
+	Num = ApplyTransform(Num, B.Transform);
+
+	switch (B.Kind)
 	{
-		BP->SetPropertyValue(Container, V);
+		case EKRollValueKind::Int32:
+			Out.IntValue = FMath::RoundToInt(Num);
+			break;
+
+		case EKRollValueKind::Int64:
+			Out.IntValue = FMath::RoundToInt64(Num);
+			break;
+
+		case EKRollValueKind::Byte:
+			Out.IntValue = FMath::Clamp(FMath::RoundToInt(Num), 0, 255);
+			break;
+
+		case EKRollValueKind::Double:
+			Out.DoubleValue = Num;
+			break;
+
+		default:
+			Out.FloatValue = static_cast<float>(Num);
+			break;
 	}
+	return true;
 }
 
-void FKRollBindingApplier::WriteInt32(FProperty* Prop, void* Container, int32 V)
+bool FKRollBindingApplier::ResolveEnum(const FKRollSnapshot& Snapshot, int32 Slot, const FKRollPropertyBinding& B, FKRollPlanWrite& Out)
 {
-	if (FIntProperty* IP = CastField<FIntProperty>(Prop))
+	if (!B.Enum)
 	{
-		IP->SetPropertyValue(Container, V);
+		return false;
 	}
+
+	// Names are accepted short ("Fast") or qualified ("EMoveSpeed::Fast")
+	auto FromName = [&B, &Out](const FString& Name)
+	{
+		const int64 Value = B.Enum->GetValueByNameString(Name);
+		if (Value == INDEX_NONE)
+		{
+			return false;
+		}
+		Out.IntValue = Value;
+		return true;
+	};
+
+	FString Text;
+	if (Snapshot.TryGetString(Slot, Text) && FromName(Text))
+	{
+		return true;
+	}
+
+	int64 Int = 0;
+	if (Snapshot.TryGetInteger(Slot, Int) && B.Enum->IsValidEnumValue(Int))
+	{
+		Out.IntValue = Int;
+		return true;
+	}
+
+	if (Snapshot.IsValidIndex(Slot))
+	{
+		const UClass* Owner = B.Property ? B.Property->GetOwnerClass() : nullptr;
+		const uint64 LogKey = FKRollLogOnce::MakeKey(Owner, B.Property, KROLL_REASON_BAD_VALUE);
+		if (FKRollLogOnce::ShouldLog(LogKey))
+		{
+			UE_LOG(LogKRoll, Warning,
+				   TEXT("KRoll: value of \"%s\" is not a %s enumerator (%s.%s)"),
+				   *Snapshot.GetKey(Slot).ToString(),
+				   *B.Enum->GetName(),
+				   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
+				   B.Property ? *B.Property->GetName() : TEXT("UnknownProp"));
+		}
+	}
+
+	// Compiled to a valid enumerator value by CompileDefault
+	if (B.Transform.DefaultValue.IsSet())
+	{
+		Out.IntValue = int64(*B.Transform.DefaultValue);
+		return true;
+	}
+	return false;
 }
 
-void FKRollBindingApplier::WriteFloat(FProperty* Prop, void* Container, float V)
+bool FKRollBindingApplier::ApplyResolvedBinding(
+	UObject* Target,
+	const FKRollPropertyBinding& B,
+	FName ResolvedKey,
+	const UKRollSubsystem* KRollSubsystem
+)
 {
-	if (FFloatProperty* FP = CastField<FFloatProperty>(Prop))
+	// AttributeSet values must be initialized through ASC. Use SeedAttribute().
+	if (!Target || !B.Writer.IsValid() || B.Kind == EKRollValueKind::GameplayAttributeData)
+	{
+		return false;
+	}
+
+	const FKRollSnapshotPtr Snapshot = KRollSubsystem ? KRollSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid())
+	{
+		return false;
+	}
+
+	FKRollPlanWrite Write;
+	TArray<FKRollPlanValue> Values;
+	if (!ResolveWrite(*Snapshot, B, ResolvedKey, Write, Values))
 	{
-		FP->SetPropertyValue(Container, V);
+		return false;
 	}
+
+	Write.Apply(reinterpret_cast<uint8*>(Target), Values.GetData());
+	return true;
 }
 
 void FKRollBindingApplier::ApplyBindings(
@@ -146,155 +817,202 @@ void FKRollBindingApplier::ApplyBindings(
 
 	for (const FKRollPropertyBinding& B : Bindings)
 	{
-		if (!B.Property || B.KeyTemplate.IsNone())
+		if (!B.Writer.IsValid() || B.KeyTemplate.IsNone())
 		{
 			continue;
 		}
 
-		const FName ResolvedKey =
-			FKRollKeyResolver::ResolveKey(
-				KeyContextActor ? static_cast<const UObject*>(KeyContextActor) : Target,
-				B.KeyTemplate
-		);
+		const FName ResolvedKey = ResolveBindingKey(B, KeyContextActor, Target);
 		if (ResolvedKey.IsNone())
 		{
 			continue;
 		}
 
-		const FString KeyStr = ResolvedKey.ToString();
-		if (KeyStr.Contains(TEXT("{")))
+		ApplyResolvedBinding(Target, B, ResolvedKey, KRollSubsystem);
+	}
+}
+
+void FKRollBindingApplier::BuildPlan(
+	const TArray<FKRollPropertyBinding>& Bindings,
+	const UObject* Target,
+	const UObject* KeyContext,
+	const UKRollSubsystem* KRollSubsystem,
+	FKRollBindingPlan& OutPlan
+)
+{
+	OutPlan.Writes.Reset(Bindings.Num());
+	OutPlan.Values.Reset();
+	OutPlan.Entries.Reset(Bindings.Num());
+
+	// One snapshot for the whole plan
+	const FKRollSnapshotPtr Snapshot = KRollSubsystem ? KRollSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid())
+	{
+		return;
+	}
+
+	for (const FKRollPropertyBinding& B : Bindings)
+	{
+		if (!B.Writer.IsValid() || B.KeyTemplate.IsNone())
 		{
-			const UClass* Owner = Target->GetClass();
-			const uint64 LogKey = FKRollLogOnce::MakeKey(Owner, B.Property, KROLL_REASON_UNRESOLVED_TOKEN);
-			if (FKRollLogOnce::ShouldLog(LogKey))
-			{
-				UE_LOG(LogKRoll, Warning,
-					   TEXT("KRoll: unresolved token in key template \"%s\" for %s.%s -> \"%s\""),
-					   *B.KeyTemplate.ToString(),
-					   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
-					   B.Property ? *B.Property->GetName() : TEXT("UnknownProp"),
-					   *KeyStr);
-			}
 			continue;
 		}
 
-		void* ValuePtr = B.Property->ContainerPtrToValuePtr<void>(Target);
-		if (!ValuePtr)
+		const FName ResolvedKey = ResolveBindingKey(B, KeyContext, Target);
+		if (ResolvedKey.IsNone())
 		{
 			continue;
 		}
 
-		switch (B.Kind)
-		{
-			case EKRollValueKind::Bool:
-			{
-				bool V = false;
-				const bool bFound = ReadBool(KRollSubsystem, ResolvedKey, V);
-				if (!bFound)
-				{
-					if (!B.Transform.DefaultValue.IsSet())
-					{
-						continue;
-					}
-					V = (*B.Transform.DefaultValue != 0.0);
-				}
-				WriteBool(B.Property, ValuePtr, V);
-				break;
-			}
+		FKRollPlanWrite Write;
+		Write.EntryIndex = OutPlan.Entries.Num();
 
-			case EKRollValueKind::Int32:
-			{
-				double Num = 0.0;
-				const bool bFound = ReadNumber(KRollSubsystem, ResolvedKey, Num);
-				if (!bFound)
-				{
-					if (!B.Transform.DefaultValue.IsSet())
-					{
-						continue;
-					}
-					Num = *B.Transform.DefaultValue;
-				}
-				Num = ApplyTransform(Num, B.Transform);
-				const int32 V = FMath::RoundToInt(Num);
-				WriteInt32(B.Property, ValuePtr, V);
-				break;
-			}
+		FKRollPlanEntry& Entry = OutPlan.Entries.AddDefaulted_GetRef();
+		Entry.Binding = &B;
+		Entry.Key = ResolvedKey;
 
-			case EKRollValueKind::Float:
-			{
-				double Num = 0.0;
-				const bool bFound = ReadNumber(KRollSubsystem, ResolvedKey, Num);
-				if (!bFound)
-				{
-					if (!B.Transform.DefaultValue.IsSet())
-					{
-						continue;
-					}
-					Num = *B.Transform.DefaultValue;
-				}
-				Num = ApplyTransform(Num, B.Transform);
-				WriteFloat(B.Property, ValuePtr, (float)Num);
-				break;
-			}
+		if (ResolveWrite(*Snapshot, B, ResolvedKey, Write, OutPlan.Values))
+		{
+			OutPlan.Writes.Add(Write);
+		}
+	}
+}
 
-			case EKRollValueKind::GameplayAttributeData:
-				// AttributeSet values must be initialized through ASC. Use ApplyAttributeSetBindings().
-				break;
+void FKRollBindingApplier::ApplyPlan(UObject* Target, const FKRollBindingPlan& Plan)
+{
+	if (!Target)
+	{
+		return;
+	}
 
-			default:
-				break;
+	uint8* Container = reinterpret_cast<uint8*>(Target);
+	for (const FKRollPlanWrite& Write : Plan.Writes)
+	{
+		// Attribute data is only seeded through ApplyAttributePlan()
+		if (Write.Kind != EKRollValueKind::GameplayAttributeData)
+		{
+			Write.Apply(Container, Plan.Values.GetData());
 		}
 	}
 }
 
-void FKRollBindingApplier::ApplyAttributeSetBindings(
-	UAttributeSet* AttributeSet,
-	UAbilitySystemComponent* ASC,
-	const TArray<FKRollPropertyBinding>& Bindings,
-	const UKRollSubsystem* KRollSubsystem,
-	const AActor* KeyContextActor
-)
+bool FKRollBindingApplier::ApplyAttributePlan(UAttributeSet* AttributeSet, const FKRollBindingPlan& Plan)
 {
-	if (!AttributeSet || !ASC || !KRollSubsystem || !KRollSubsystem->IsReady())
+	if (!AttributeSet)
 	{
-		return;
+		return false;
 	}
 
 	bool bWroteAny = false;
 
-	for (const FKRollPropertyBinding& B : Bindings)
+	uint8* Container = reinterpret_cast<uint8*>(AttributeSet);
+	for (const FKRollPlanWrite& Write : Plan.Writes)
 	{
-		if (B.Kind != EKRollValueKind::GameplayAttributeData || !B.Property)
+		if (Write.Kind == EKRollValueKind::GameplayAttributeData)
+		{
+			Write.Apply(Container, Plan.Values.GetData());
+			bWroteAny = true;
+		}
+	}
+	return bWroteAny;
+}
+
+UGameplayEffect* FKRollBindingApplier::BuildSeedEffect(const FKRollBindingPlan& Plan)
+{
+	check(IsInGameThread());
+
+	UGameplayEffect* Effect = nullptr;
+
+	for (const FKRollPlanWrite& Write : Plan.Writes)
+	{
+		if (Write.Kind != EKRollValueKind::GameplayAttributeData || !Plan.Entries.IsValidIndex(Write.EntryIndex))
 		{
 			continue;
 		}
 
-		double Num = 0.0;
-		if (!ResolveNumericBindingValue(B, KRollSubsystem, KeyContextActor, AttributeSet, Num))
+		AddSeedModifier(Effect, Plan.Entries[Write.EntryIndex].Binding->Property, Write.FloatValue);
+	}
+	return Effect;
+}
+
+bool FKRollBindingApplier::ApplySeedEffect(UAbilitySystemComponent* ASC, const UGameplayEffect* SeedEffect)
+{
+	if (!ASC || !SeedEffect)
+	{
+		return false;
+	}
+
+	// The effect is shared; the spec is not, as its context names this ASC as instigator
+	const FGameplayEffectSpec Spec(SeedEffect, ASC->MakeEffectContext(), 1.f);
+	ASC->ApplyGameplayEffectSpecToSelf(Spec);
+	return true;
+}
+
+UGameplayEffect* FKRollBindingApplier::BuildSeedEffect(
+	TConstArrayView<FKRollPlanEntry> Seeds,
+	const UKRollSubsystem* KRollSubsystem
+)
+{
+	check(IsInGameThread());
+
+	const FKRollSnapshotPtr Snapshot = KRollSubsystem ? KRollSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid())
+	{
+		return nullptr;
+	}
+
+	UGameplayEffect* Effect = nullptr;
+	TArray<FKRollPlanValue> Values;
+
+	for (const FKRollPlanEntry& Seed : Seeds)
+	{
+		const FKRollPropertyBinding& B = *Seed.Binding;
+		if (B.Kind != EKRollValueKind::GameplayAttributeData)
 		{
 			continue;
 		}
 
-		// DataTable-style seeding: write directly into the AttributeSet memory.
-		// This bypasses ASC->SetNumericAttributeBase and therefore bypasses PreAttributeBaseChange clamps.
-		if (FStructProperty* StructProp = CastField<FStructProperty>(B.Property))
+		FKRollPlanWrite Write;
+		if (ResolveWrite(*Snapshot, B, Seed.Key, Write, Values))
 		{
-			// We only cache GameplayAttributeData properties under this kind.
-			if (StructProp->Struct == TBaseStructure<FGameplayAttributeData>::Get())
-			{
-				FGameplayAttributeData* DataPtr = StructProp->ContainerPtrToValuePtr<FGameplayAttributeData>(AttributeSet);
-				if (DataPtr)
-				{
-					const float V = static_cast<float>(Num);
-					DataPtr->SetBaseValue(V);
-					DataPtr->SetCurrentValue(V);
-					bWroteAny = true;
-				}
-			}
+			AddSeedModifier(Effect, B.Property, Write.FloatValue);
 		}
 	}
+	return Effect;
+}
 
-	if (!bWroteAny)
+bool FKRollBindingApplier::SeedAttribute(
+	UAttributeSet* AttributeSet,
+	const FKRollPropertyBinding& B,
+	FName ResolvedKey,
+	const UKRollSubsystem* KRollSubsystem
+)
+{
+	if (!AttributeSet || B.Kind != EKRollValueKind::GameplayAttributeData || !B.Writer.IsValid())
+	{
+		return false;
+	}
+
+	const FKRollSnapshotPtr Snapshot = KRollSubsystem ? KRollSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid())
+	{
+		return false;
+	}
+
+	FKRollPlanWrite Write;
+	TArray<FKRollPlanValue> Values;
+	if (!ResolveWrite(*Snapshot, B, ResolvedKey, Write, Values))
+	{
+		return false;
+	}
+
+	Write.Apply(reinterpret_cast<uint8*>(AttributeSet), Values.GetData());
+	return true;
+}
+
+void FKRollBindingApplier::NudgeReplication(UAbilitySystemComponent* ASC)
+{
+	if (!ASC)
 	{
 		return;
 	}
@@ -309,3 +1027,42 @@ void FKRollBindingApplier::ApplyAttributeSetBindings(
 
 	ASC->ForceReplication();
 }
+
+bool FKRollBindingApplier::ApplyAttributeSetBindings(
+	UAttributeSet* AttributeSet,
+	UAbilitySystemComponent* ASC,
+	const TArray<FKRollPropertyBinding>& Bindings,
+	const UKRollSubsystem* KRollSubsystem,
+	const AActor* KeyContextActor,
+	bool bNudgeReplication
+)
+{
+	if (!AttributeSet || !ASC || !KRollSubsystem || !KRollSubsystem->IsReady())
+	{
+		return false;
+	}
+
+	bool bWroteAny = false;
+
+	for (const FKRollPropertyBinding& B : Bindings)
+	{
+		if (B.Kind != EKRollValueKind::GameplayAttributeData || !B.Writer.IsValid() || B.KeyTemplate.IsNone())
+		{
+			continue;
+		}
+
+		const FName ResolvedKey = ResolveBindingKey(B, KeyContextActor, AttributeSet);
+		if (ResolvedKey.IsNone())
+		{
+			continue;
+		}
+
+		bWroteAny |= SeedAttribute(AttributeSet, B, ResolvedKey, KRollSubsystem);
+	}
+
+	if (bWroteAny && bNudgeReplication)
+	{
+		NudgeReplication(ASC);
+	}
+	return bWroteAny;
+}
@@ -1,17 +1,33 @@
 #include "KRollBindingCache.h"
 
 #include "GameFramework/Actor.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
 #include "Components/ActorComponent.h"
 #include "KRollLog.h"
+#include "KRollKeyResolver.h"
+#include "KRollBindingApplier.h"
+#include "KRollSubsystem.h"
+#include "KRollBindingManifest.h"
 
 // GAS attribute data type
+#include "AbilitySystemInterface.h"
 #include "AttributeSet.h" // FGameplayAttributeData
+#include "GameplayEffect.h"
 
+#if WITH_METADATA
 static constexpr TCHAR META_KRollKey[]      = TEXT("KRollKey");
 static constexpr TCHAR META_KRollDefault[]  = TEXT("KRollDefault");
 static constexpr TCHAR META_KRollScale[]    = TEXT("KRollScale");
 static constexpr TCHAR META_KRollClampMin[] = TEXT("KRollClampMin");
 static constexpr TCHAR META_KRollClampMax[] = TEXT("KRollClampMax");
+#endif
+
+FKRollBindingCache::FKRollBindingCache(const UKRollBindingManifest* InManifest)
+	: Manifest(InManifest)
+{
+}
 
 const FKRollClassBindings& FKRollBindingCache::GetOrBuildActorBindings(UClass* ActorClass)
 {
@@ -21,39 +37,53 @@ const FKRollClassBindings& FKRollBindingCache::GetOrBuildActorBindings(UClass* A
 		return Empty;
 	}
 
-	if (FKRollClassBindings* Existing = ActorCache.Find(ActorClass))
+	if (const TUniquePtr<FKRollClassBindings>* Existing = ActorCache.Find(ActorClass))
 	{
-		return *Existing;
+		return **Existing;
 	}
 
-	FKRollClassBindings Built;
+	TUniquePtr<FKRollClassBindings> BuiltPtr = MakeUnique<FKRollClassBindings>();
+	FKRollClassBindings& Built = *BuiltPtr;
 
 	// Actor properties
 	CollectBindingsForClass(ActorClass, Built.ActorBindings, /*bAllowGameplayAttributeData*/ false);
 
 	// Component properties: discover component classes from the actor CDO
-	const AActor* CDO = Cast<AActor>(ActorClass->GetDefaultObject());
-	if (CDO)
+	if (const AActor* CDO = Cast<AActor>(ActorClass->GetDefaultObject()))
 	{
-		TArray<UActorComponent*> Components;
-		CDO->GetComponents(Components);
+		TArray<UClass*, TInlineAllocator<16>> SeenClasses;
 
-		for (UActorComponent* Comp : Components)
+		CDO->ForEachComponent(/*bIncludeFromChildActors*/ false, [this, &Built, &SeenClasses](UActorComponent* Comp)
 		{
-			if (!Comp)
+			UClass* CompClass = Comp->GetClass();
+			if (SeenClasses.Contains(CompClass))
 			{
-				continue;
+				return;
 			}
+			SeenClasses.Add(CompClass);
 
-			UClass* CompClass = Comp->GetClass();
-			TArray<FKRollPropertyBinding>& CompBindings = Built.ComponentBindings.FindOrAdd(CompClass);
-
+			TArray<FKRollPropertyBinding> CompBindings;
 			CollectBindingsForClass(CompClass, CompBindings, /*bAllowGameplayAttributeData*/ false);
-		}
+			if (!CompBindings.IsEmpty())
+			{
+				Built.ComponentBindings.Add(CompClass, MoveTemp(CompBindings));
+			}
+		});
 	}
 
-	ActorCache.Add(ActorClass, MoveTemp(Built));
-	return *ActorCache.Find(ActorClass);
+	Built.bHasActorBindings = !Built.ActorBindings.IsEmpty();
+	Built.bHasComponentBindings = !Built.ComponentBindings.IsEmpty();
+
+	// Attribute sets are reached through the actor's ASC; only these classes look for one
+	// (instances of other classes still qualify through an ASC component of their own)
+	Built.bIsAbilitySystemContext =
+		ActorClass->ImplementsInterface(UAbilitySystemInterface::StaticClass())
+		|| ActorClass->IsChildOf(APawn::StaticClass())
+		|| ActorClass->IsChildOf(AController::StaticClass())
+		|| ActorClass->IsChildOf(APlayerState::StaticClass());
+
+	ActorCache.Add(ActorClass, MoveTemp(BuiltPtr));
+	return Built;
 }
 
 const TArray<FKRollPropertyBinding>& FKRollBindingCache::GetOrBuildAttributeSetBindings(UClass* AttributeSetClass)
@@ -64,93 +94,518 @@ const TArray<FKRollPropertyBinding>& FKRollBindingCache::GetOrBuildAttributeSetB
 		return Empty;
 	}
 
-	if (TArray<FKRollPropertyBinding>* Existing = AttributeSetCache.Find(AttributeSetClass))
+	if (const TUniquePtr<TArray<FKRollPropertyBinding>>* Existing = AttributeSetCache.Find(AttributeSetClass))
 	{
-		return *Existing;
+		return **Existing;
 	}
 
-	TArray<FKRollPropertyBinding> Built;
-	CollectBindingsForClass(AttributeSetClass, Built, /*bAllowGameplayAttributeData*/ true);
+	TUniquePtr<TArray<FKRollPropertyBinding>> Built = MakeUnique<TArray<FKRollPropertyBinding>>();
+	CollectBindingsForClass(AttributeSetClass, *Built, /*bAllowGameplayAttributeData*/ true);
 
+	const TArray<FKRollPropertyBinding>& Result = *Built;
 	AttributeSetCache.Add(AttributeSetClass, MoveTemp(Built));
-	return *AttributeSetCache.Find(AttributeSetClass);
+	return Result;
+}
+
+void FKRollBindingCache::SetNoAttributeBindings(UClass* ActorClass, bool bNoAttributeBindings)
+{
+	check(IsInGameThread());
+
+	if (const TUniquePtr<FKRollClassBindings>* Existing = ActorCache.Find(ActorClass))
+	{
+		(*Existing)->bNoAttributeBindings = bNoAttributeBindings;
+	}
+}
+
+const FKRollBindingPlan& FKRollBindingCache::GetOrBuildPlan(
+	const TArray<FKRollPropertyBinding>& Bindings,
+	const UObject* Target,
+	const UObject* KeyContext,
+	const UKRollSubsystem* KRollSubsystem
+)
+{
+	static const FKRollBindingPlan Empty;
+	if (Bindings.IsEmpty() || !Target || !KeyContext || !KRollSubsystem)
+	{
+		return Empty;
+	}
+
+	const AActor* OwningActor = FKRollKeyResolver::ResolveOwningActor(KeyContext);
+
+	uint8 TokenMask = 0;
+	for (const FKRollPropertyBinding& B : Bindings)
+	{
+		TokenMask |= B.Template.TokenMask;
+	}
+
+	// Keyed by class, not by the list's address: an address can be reused by another list once freed
+	FPlanKey Key;
+	Key.Kind = Target->IsA<AActor>() ? EListKind::Actor
+		: Target->IsA<UActorComponent>() ? EListKind::Component
+		: EListKind::AttributeSet;
+	Key.ListClass = FObjectKey(Target->GetClass());
+	Key.ContextClass = FObjectKey(KeyContext->GetClass());
+	Key.OwnerClass = FObjectKey(OwningActor ? OwningActor->GetClass() : nullptr);
+	Key.Archetype = FKRollKeyResolver::GetArchetypeName(OwningActor);
+
+	// Only lists that use these tokens get per-component / per-level plans
+	if (TokenMask & (1 << uint8(EKRollKeyToken::Component)))
+	{
+		Key.Component = Target->GetFName();
+	}
+	if (TokenMask & (1 << uint8(EKRollKeyToken::Level)))
+	{
+		Key.Level = FObjectKey(OwningActor ? OwningActor->GetLevel() : nullptr);
+	}
+
+	const uint32 Generation = KRollSubsystem->GetSnapshotGeneration();
+	{
+		FReadScopeLock ReadLock(PlansLock);
+		const TUniquePtr<FKRollBindingPlan>* Existing = Plans.Find(Key);
+		if (Existing && (*Existing)->Generation == Generation)
+		{
+			return **Existing;
+		}
+	}
+
+	// Build outside the lock so distinct plans compile in parallel
+	FKRollBindingPlan Built;
+	FKRollBindingApplier::BuildPlan(Bindings, Target, KeyContext, KRollSubsystem, Built);
+	Built.Generation = Generation;
+
+	FWriteScopeLock WriteLock(PlansLock);
+	TUniquePtr<FKRollBindingPlan>& Plan = Plans.FindOrAdd(Key);
+	if (!Plan.IsValid())
+	{
+		Plan = MakeUnique<FKRollBindingPlan>(MoveTemp(Built));
+	}
+	else if (Plan->Generation != Generation)
+	{
+		// Only stale plans are replaced; nobody holds those during a resolve pass
+		*Plan = MoveTemp(Built);
+	}
+	return *Plan;
+}
+
+const UGameplayEffect* FKRollBindingCache::GetOrBuildSeedEffect(const FKRollBindingPlan& Plan)
+{
+	check(IsInGameThread());
+
+	FSeedEffect& Seed = SeedEffects.FindOrAdd(&Plan);
+	if (Seed.Generation != Plan.Generation)
+	{
+		Seed.Effect.Reset(FKRollBindingApplier::BuildSeedEffect(Plan));
+		Seed.Generation = Plan.Generation;
+	}
+	return Seed.Effect.Get();
+}
+
+const UGameplayEffect* FKRollBindingCache::GetOrBuildUpdateSeedEffect(
+	TConstArrayView<FKRollPlanEntry> Seeds,
+	const UKRollSubsystem* KRollSubsystem
+)
+{
+	check(IsInGameThread());
+
+	if (Seeds.IsEmpty() || !KRollSubsystem)
+	{
+		return nullptr;
+	}
+
+	const uint32 Generation = KRollSubsystem->GetSnapshotGeneration();
+	if (UpdateSeedGeneration != Generation)
+	{
+		UpdateSeedEffects.Reset();
+		UpdateSeedGeneration = Generation;
+	}
+
+	FUpdateSeedKey Key;
+	Key.Entries.Append(Seeds.GetData(), Seeds.Num());
+	Key.Entries.Sort([](const FKRollPlanEntry& A, const FKRollPlanEntry& B)
+	{
+		return A.Binding != B.Binding ? A.Binding < B.Binding : A.Key.FastLess(B.Key);
+	});
+
+	if (const TStrongObjectPtr<UGameplayEffect>* Found = UpdateSeedEffects.Find(Key))
+	{
+		return Found->Get();
+	}
+
+	UGameplayEffect* Effect = FKRollBindingApplier::BuildSeedEffect(Key.Entries, KRollSubsystem);
+	UpdateSeedEffects.Add(MoveTemp(Key), TStrongObjectPtr<UGameplayEffect>(Effect));
+	return Effect;
+}
+
+void FKRollBindingCache::PruneStaleClasses()
+{
+	check(IsInGameThread());
+
+	// Keyed by bindings that may belong to the classes going away
+	UpdateSeedEffects.Reset();
+
+	for (auto It = ActorCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = AttributeSetCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	FWriteScopeLock WriteLock(PlansLock);
+	for (auto It = Plans.CreateIterator(); It; ++It)
+	{
+		const FPlanKey& Key = It.Key();
+		const bool bStale = !Key.ListClass.ResolveObjectPtr() || !Key.ContextClass.ResolveObjectPtr()
+			|| (Key.OwnerClass != FObjectKey() && !Key.OwnerClass.ResolveObjectPtr())
+			|| (Key.Level != FObjectKey() && !Key.Level.ResolveObjectPtr());
+		if (bStale)
+		{
+			SeedEffects.Remove(It.Value().Get());
+			It.RemoveCurrent();
+		}
+	}
 }
 
 void FKRollBindingCache::CollectBindingsForClass(
 	UClass* Class,
 	TArray<FKRollPropertyBinding>& Out,
 	bool bAllowGameplayAttributeData
+) const
+{
+	TArray<FBindingSpec> Specs;
+
+	if (Manifest.IsValid())
+	{
+		// No reflection walk: the manifest names the bound properties
+		if (const FKRollManifestClass* Entry = Manifest->FindClass(Class))
+		{
+			GatherManifestSpecs(*Entry, Class, Specs);
+		}
+	}
+	else
+	{
+#if WITH_METADATA
+		GatherMetadataSpecs(Class, /*BaseOffset*/ 0, FString(), FString(), Specs, /*Depth*/ 0);
+#endif
+	}
+
+	Out.Reserve(Out.Num() + Specs.Num());
+	for (const FBindingSpec& Spec : Specs)
+	{
+		FKRollPropertyBinding Binding;
+		if (BuildBinding(Spec, Binding, bAllowGameplayAttributeData))
+		{
+			Out.Add(MoveTemp(Binding));
+		}
+	}
+}
+
+void FKRollBindingCache::GatherManifestSpecs(const FKRollManifestClass& Entry, const UClass* Class, TArray<FBindingSpec>& Out)
+{
+	TArray<FString> Segments;
+
+	for (const FKRollManifestBinding& Binding : Entry.Bindings)
+	{
+		Segments.Reset();
+		Binding.PropertyPath.ParseIntoArray(Segments, TEXT("."));
+		if (Segments.IsEmpty())
+		{
+			continue;
+		}
+
+		// Offsets are taken from this build's layout
+		const UStruct* Struct = Class;
+		uint32 BaseOffset = 0;
+		for (int32 Idx = 0; Struct && Idx < Segments.Num() - 1; ++Idx)
+		{
+			const FStructProperty* StructProp = FindFProperty<FStructProperty>(Struct, *Segments[Idx]);
+			BaseOffset += StructProp ? uint32(StructProp->GetOffset_ForInternal()) : 0;
+			Struct = StructProp ? StructProp->Struct : nullptr;
+		}
+
+		FProperty* Prop = Struct ? FindFProperty<FProperty>(Struct, *Segments.Last()) : nullptr;
+		if (!Prop)
+		{
+			UE_LOG(LogKRoll, Warning,
+				   TEXT("KRoll: binding manifest lists %s.%s, which does not exist; rebuild the manifest"),
+				   *Class->GetName(),
+				   *Binding.PropertyPath);
+			continue;
+		}
+
+		FBindingSpec& Spec = Out.AddDefaulted_GetRef();
+		Spec.Property = Prop;
+		Spec.BaseOffset = BaseOffset;
+		Spec.Path = Binding.PropertyPath;
+		Spec.Key = Binding.Key;
+		Spec.Transform.Scale = Binding.Scale;
+		if (Binding.bHasClampMin)
+		{
+			Spec.Transform.ClampMin = Binding.ClampMin;
+		}
+		if (Binding.bHasClampMax)
+		{
+			Spec.Transform.ClampMax = Binding.ClampMax;
+		}
+		if (Binding.bHasDefault)
+		{
+			Spec.Transform.DefaultText = Binding.Default;
+		}
+	}
+}
+
+#if WITH_METADATA
+void FKRollBindingCache::GatherMetadataSpecs(
+	const UStruct* Struct,
+	uint32 BaseOffset,
+	const FString& PathPrefix,
+	const FString& KeyPrefix,
+	TArray<FBindingSpec>& Out,
+	int32 Depth
 )
 {
-	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	// Inside a scope every member is bound, by its KRollKey or else its name
+	const bool bInScope = !KeyPrefix.IsEmpty();
+
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
 	{
 		FProperty* Prop = *It;
+		FString KeyStr = Prop->GetMetaData(META_KRollKey);
+		const bool bExplicitKey = !KeyStr.IsEmpty();
+		if (!bExplicitKey && !bInScope)
+		{
+			continue;
+		}
+		if (!bExplicitKey)
+		{
+			KeyStr = Prop->GetName();
+		}
+
+		const FString Path = PathPrefix + Prop->GetName();
+
+		// A KRollKey on a plain struct opens a scope: members are addressed as "<key>.<member>"
+		const FStructProperty* StructProp = CastField<FStructProperty>(Prop);
+		if (StructProp && !IsValueStruct(StructProp->Struct))
+		{
+			if (Depth < MaxStructDepth)
+			{
+				const uint32 MemberOffset = BaseOffset + uint32(Prop->GetOffset_ForInternal());
+				GatherMetadataSpecs(StructProp->Struct, MemberOffset, Path + TEXT("."), KeyPrefix + KeyStr + TEXT("."), Out, Depth + 1);
+			}
+			continue;
+		}
+
+		FBindingSpec& Spec = Out.AddDefaulted_GetRef();
+		Spec.Property = Prop;
+		Spec.BaseOffset = BaseOffset;
+		Spec.Path = Path;
+		Spec.Key = KeyPrefix + KeyStr;
+		Spec.bExplicitKey = bExplicitKey;
+		ParseTransformMeta(Prop, Spec.Transform);
+	}
+}
+
+void FKRollBindingCache::DescribeClassBindings(UClass* Class, TArray<FKRollManifestBinding>& Out)
+{
+	if (!Class)
+	{
+		return;
+	}
+
+	TArray<FBindingSpec> Specs;
+	GatherMetadataSpecs(Class, /*BaseOffset*/ 0, FString(), FString(), Specs, /*Depth*/ 0);
+
+	const bool bAllowGameplayAttributeData = Class->IsChildOf(UAttributeSet::StaticClass());
+
+	for (const FBindingSpec& Spec : Specs)
+	{
+		// Only what the runtime would bind
 		FKRollPropertyBinding Binding;
-		if (TryBuildBindingFromProperty(Prop, Binding, bAllowGameplayAttributeData))
+		if (!BuildBinding(Spec, Binding, bAllowGameplayAttributeData))
 		{
-			Out.Add(MoveTemp(Binding));
+			continue;
 		}
+
+		FKRollManifestBinding& Entry = Out.AddDefaulted_GetRef();
+		Entry.PropertyPath = Spec.Path;
+		Entry.Key = Spec.Key;
+		Entry.Scale = Spec.Transform.Scale;
+		Entry.bHasClampMin = Spec.Transform.ClampMin.IsSet();
+		Entry.ClampMin = Spec.Transform.ClampMin.Get(0.0);
+		Entry.bHasClampMax = Spec.Transform.ClampMax.IsSet();
+		Entry.ClampMax = Spec.Transform.ClampMax.Get(0.0);
+		Entry.bHasDefault = Spec.Transform.DefaultText.IsSet();
+		Entry.Default = Spec.Transform.DefaultText.Get(FString());
 	}
 }
+#endif
+
+bool FKRollBindingCache::IsValueStruct(const UScriptStruct* Struct)
+{
+	// Structs bound as one value rather than opened as a scope
+	return Struct == TBaseStructure<FVector>::Get()
+		|| Struct == TBaseStructure<FRotator>::Get()
+		|| Struct == TBaseStructure<FLinearColor>::Get()
+		|| Struct == FGameplayAttributeData::StaticStruct();
+}
 
-bool FKRollBindingCache::TryBuildBindingFromProperty(
-	FProperty* Prop,
+bool FKRollBindingCache::BuildBinding(
+	const FBindingSpec& Spec,
 	FKRollPropertyBinding& Out,
 	bool bAllowGameplayAttributeData
 )
 {
-	if (!Prop || !Prop->HasMetaData(META_KRollKey))
+	FProperty* Prop = Spec.Property;
+	const FString& KeyStr = Spec.Key;
+	if (!Prop || KeyStr.IsEmpty())
 	{
 		return false;
 	}
 
-	const FString KeyStr = Prop->GetMetaData(META_KRollKey);
-	if (KeyStr.IsEmpty())
+	FString TemplateError;
+	Out.Template = FKRollKeyTemplate::Compile(KeyStr, &TemplateError);
+	if (!Out.Template.IsValid())
 	{
+		const UClass* Owner = Prop->GetOwnerClass();
+		const uint64 Key = FKRollLogOnce::MakeKey(Owner, Prop, KROLL_REASON_UNRESOLVED_TOKEN);
+		if (FKRollLogOnce::ShouldLog(Key))
+		{
+			UE_LOG(LogKRoll, Warning,
+				   TEXT("KRoll: invalid key template \"%s\" on %s.%s (%s)"),
+				   *KeyStr,
+				   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
+				   *Prop->GetName(),
+				   *TemplateError);
+		}
 		return false;
 	}
 
 	Out.Property = Prop;
 	Out.KeyTemplate = FName(*KeyStr);
+	if (!Out.Template.HasTokens())
+	{
+		Out.StaticKey = FKRollKeyHandle(Out.KeyTemplate);
+	}
 
-	ParseTransformMeta(Prop, Out.Transform);
+	Out.Transform = Spec.Transform;
 
-	// Supported primitive kinds
+	bool bSupported = true;
 	if (CastField<FBoolProperty>(Prop))
 	{
 		Out.Kind = EKRollValueKind::Bool;
-		return true;
 	}
-	if (CastField<FIntProperty>(Prop))
+	else if (CastField<FIntProperty>(Prop))
 	{
 		Out.Kind = EKRollValueKind::Int32;
-		return true;
 	}
-	if (CastField<FFloatProperty>(Prop))
+	else if (CastField<FInt64Property>(Prop))
+	{
+		Out.Kind = EKRollValueKind::Int64;
+	}
+	else if (CastField<FFloatProperty>(Prop))
 	{
 		Out.Kind = EKRollValueKind::Float;
-		return true;
+	}
+	else if (CastField<FDoubleProperty>(Prop))
+	{
+		Out.Kind = EKRollValueKind::Double;
+	}
+	else if (const FByteProperty* ByteProp = CastField<FByteProperty>(Prop))
+	{
+		Out.Kind = ByteProp->Enum ? EKRollValueKind::Enum : EKRollValueKind::Byte;
+		Out.Enum = ByteProp->Enum;
+	}
+	else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Prop))
+	{
+		Out.Kind = EKRollValueKind::Enum;
+		Out.Enum = EnumProp->GetEnum();
+	}
+	else if (CastField<FNameProperty>(Prop))
+	{
+		Out.Kind = EKRollValueKind::Name;
+	}
+	else if (CastField<FStrProperty>(Prop))
+	{
+		Out.Kind = EKRollValueKind::String;
+	}
+	else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Prop); ArrayProp && CastField<FFloatProperty>(ArrayProp->Inner))
+	{
+		Out.Kind = EKRollValueKind::FloatArray;
+	}
+	else if (const FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+	{
+		if (StructProp->Struct == TBaseStructure<FVector>::Get())
+		{
+			Out.Kind = EKRollValueKind::Vector;
+		}
+		else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
+		{
+			Out.Kind = EKRollValueKind::Rotator;
+		}
+		else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
+		{
+			Out.Kind = EKRollValueKind::LinearColor;
+		}
+		// AttributeData only when building for AttributeSet classes
+		else if (bAllowGameplayAttributeData && StructProp->Struct == FGameplayAttributeData::StaticStruct())
+		{
+			Out.Kind = EKRollValueKind::GameplayAttributeData;
+		}
+		else
+		{
+			bSupported = false;
+		}
+	}
+	else
+	{
+		bSupported = false;
 	}
 
-	// AttributeData only when building for AttributeSet classes
-	if (bAllowGameplayAttributeData)
+	if (bSupported)
 	{
-		if (FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+		// Offset and store function are fixed from here on; application never looks at the FProperty
+		Out.Writer = FKRollBindingApplier::CompileWriter(Prop, Out.Kind);
+		if (Out.Writer.IsValid())
 		{
-			if (StructProp->Struct == FGameplayAttributeData::StaticStruct())
+			Out.Writer.Offset += Spec.BaseOffset;
+
+			// A default that does not fit the kind is dropped rather than read as 0
+			if (!FKRollBindingApplier::CompileDefault(Out))
 			{
-				Out.Kind = EKRollValueKind::GameplayAttributeData;
-				return true;
+				const UClass* Owner = Prop->GetOwnerClass();
+				const uint64 Key = FKRollLogOnce::MakeKey(Owner, Prop, KROLL_REASON_BAD_META_NUMERIC);
+				if (FKRollLogOnce::ShouldLog(Key))
+				{
+					UE_LOG(LogKRoll, Warning,
+						   TEXT("KRoll: KRollDefault \"%s\" on %s.%s is not a valid value for the property; ignoring it"),
+						   Spec.Transform.DefaultText.IsSet() ? **Spec.Transform.DefaultText : TEXT(""),
+						   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
+						   *Prop->GetName());
+				}
 			}
+			return true;
 		}
 	}
 
+	if (!Spec.bExplicitKey)
+	{
+		return false;
+	}
+
 	const UClass* Owner = Prop->GetOwnerClass();
 	const uint64 Key = FKRollLogOnce::MakeKey(Owner, Prop, KROLL_REASON_UNSUPPORTED_PROP);
 	if (FKRollLogOnce::ShouldLog(Key))
 	{
 		UE_LOG(LogKRoll, Warning,
-			   TEXT("KRoll: unsupported property type for binding on %s.%s (property type: %s). Supported: bool/int32/float%s"),
+			   TEXT("KRoll: unsupported property type for binding on %s.%s (property type: %s). Supported: ")
+			   TEXT("bool/int32/int64/uint8/enum/float/double/FName/FString/FVector/FRotator/FLinearColor/TArray<float>%s, or a struct of those"),
 			   Owner ? *Owner->GetName() : TEXT("UnknownClass"),
 			   *Prop->GetName(),
 			   *Prop->GetClass()->GetName(),
@@ -159,6 +614,7 @@ bool FKRollBindingCache::TryBuildBindingFromProperty(
 	return false;
 }
 
+#if WITH_METADATA
 void FKRollBindingCache::ParseTransformMeta(FProperty* Prop, FKRollTransform& Out)
 {
 	// Scale (optional)
@@ -168,8 +624,11 @@ void FKRollBindingCache::ParseTransformMeta(FProperty* Prop, FKRollTransform& Ou
 	ParseOptionalDoubleMeta(Prop, META_KRollClampMin, Out.ClampMin);
 	ParseOptionalDoubleMeta(Prop, META_KRollClampMax, Out.ClampMax);
 
-	// Default (optional)
-	ParseOptionalDoubleMeta(Prop, META_KRollDefault, Out.DefaultValue);
+	// Default (optional); kept as written and compiled for the value kind in BuildBinding
+	if (Prop && Prop->HasMetaData(META_KRollDefault) && !Prop->GetMetaData(META_KRollDefault).IsEmpty())
+	{
+		Out.DefaultText = Prop->GetMetaData(META_KRollDefault);
+	}
 }
 
 bool FKRollBindingCache::ParseOptionalDoubleMeta(FProperty* Prop, const TCHAR* MetaKey, TOptional<double>& OutVal)
@@ -205,3 +664,4 @@ bool FKRollBindingCache::ParseDoubleMeta(FProperty* Prop, const TCHAR* MetaKey,
 	OutVal = FCString::Atod(*V);
 	return true;
 }
+#endif
@@ -0,0 +1,85 @@
+#include "KRollBindingManifest.h"
+
+#include "KRollBindingCache.h"
+#include "KRollBindingTypes.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+const FKRollManifestClass* UKRollBindingManifest::FindClass(const UClass* Class) const
+{
+	// Blueprint classes are not listed; their bindings are those of the nearest native ancestor
+	for (const UClass* It = Class; It; It = It->GetSuperClass())
+	{
+		if (const int32* Index = ClassIndex.Find(It->GetClassPathName()))
+		{
+			return &Classes[*Index];
+		}
+	}
+	return nullptr;
+}
+
+void UKRollBindingManifest::PostLoad()
+{
+	Super::PostLoad();
+	BuildIndex();
+}
+
+void UKRollBindingManifest::BuildIndex()
+{
+	ClassIndex.Reset();
+	ClassIndex.Reserve(Classes.Num());
+
+	for (int32 Index = 0; Index < Classes.Num(); ++Index)
+	{
+		// Not resolved here: the class's module may not be loaded yet
+		ClassIndex.Add(Classes[Index].Class.GetAssetPath(), Index);
+	}
+}
+
+#if WITH_METADATA
+bool UKRollBindingManifest::Rebuild()
+{
+	TArray<FKRollManifestClass> Built;
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!Class->HasAnyClassFlags(CLASS_Native) || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		// Classes of editor modules (e.g. test fixtures) never exist in a cooked game
+		if (Class->GetOutermost()->HasAnyPackageFlags(PKG_EditorOnly))
+		{
+			continue;
+		}
+
+		TArray<FKRollManifestBinding> Bindings;
+		FKRollBindingCache::DescribeClassBindings(Class, Bindings);
+		if (Bindings.IsEmpty())
+		{
+			continue;
+		}
+
+		FKRollManifestClass& Entry = Built.AddDefaulted_GetRef();
+		Entry.Class = FSoftClassPath(Class);
+		Entry.Bindings = MoveTemp(Bindings);
+	}
+
+	// Stable order, so an unchanged project produces an identical asset
+	Built.Sort([](const FKRollManifestClass& A, const FKRollManifestClass& B)
+	{
+		return A.Class.ToString() < B.Class.ToString();
+	});
+
+	if (Built == Classes)
+	{
+		return false;
+	}
+
+	Classes = MoveTemp(Built);
+	BuildIndex();
+	return true;
+}
+#endif
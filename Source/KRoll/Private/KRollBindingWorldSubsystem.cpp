@@ -2,7 +2,9 @@
 
 #include "KRollSubsystem.h"
 #include "KRollBindingApplier.h"
+#include "KRollSettings.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "GameFramework/Actor.h"
@@ -10,6 +12,8 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerState.h"
 #include "Components/ActorComponent.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UObjectGlobals.h"
 
 // GAS
 #include "AbilitySystemInterface.h"
@@ -18,7 +22,9 @@
 
 namespace
 {
-void AddUniqueActor(TArray<AActor*>& InOutActors, AActor* Actor)
+using FKRollContextCandidates = TArray<AActor*, TInlineAllocator<8>>;
+
+void AddUniqueActor(FKRollContextCandidates& InOutActors, AActor* Actor)
 {
 	if (Actor)
 	{
@@ -79,8 +85,7 @@ UAbilitySystemComponent* ResolveASCAndKeyContext(AActor* SourceActor, AActor*& O
 {
 	OutKeyContext = ResolvePawnLikeContext(SourceActor);
 
-	TArray<AActor*> Candidates;
-	Candidates.Reserve(8);
+	FKRollContextCandidates Candidates;
 	AddUniqueActor(Candidates, OutKeyContext);
 	AddUniqueActor(Candidates, SourceActor);
 
@@ -140,18 +145,28 @@ void UKRollBindingWorldSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	if (UGameInstance* GI = World->GetGameInstance())
 	{
 		KRoll = GI->GetSubsystem<UKRollSubsystem>();
+		GI->GetOnPawnControllerChanged().AddDynamic(this, &UKRollBindingWorldSubsystem::HandlePawnControllerChanged);
 	}
 
-	Cache = MakeUnique<FKRollBindingCache>();
+	Cache = MakeUnique<FKRollBindingCache>(KRoll ? KRoll->GetBindingManifest() : nullptr);
+
+	// Nothing to apply, and nothing would ever drain the queue, without a KRoll instance
+	if (!KRoll)
+	{
+		return;
+	}
 
 	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
 		FOnActorSpawned::FDelegate::CreateUObject(this, &UKRollBindingWorldSubsystem::HandleActorSpawned)
 	);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(
+		this, &UKRollBindingWorldSubsystem::HandlePostGarbageCollect);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(
+		this, &UKRollBindingWorldSubsystem::HandleLevelRemovedFromWorld);
 
-	if (KRoll)
-	{
-		KRoll->OnConfigReady.AddDynamic(this, &UKRollBindingWorldSubsystem::OnConfigReady);
-	}
+	KRoll->OnConfigReady.AddDynamic(this, &UKRollBindingWorldSubsystem::OnConfigReady);
+	KeysChangedHandle = KRoll->SubscribePrefix(FString(),
+		FKRollKeysChangedDelegate::CreateUObject(this, &UKRollBindingWorldSubsystem::HandleKeysChanged));
 
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
@@ -160,7 +175,13 @@ void UKRollBindingWorldSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 		{
 			continue;
 		}
-		ScheduleInitNextTick(Actor);
+
+		if (!HasBindingWork(Actor))
+		{
+			++QueueStats.SkippedSpawns;
+			continue;
+		}
+		EnqueueActor(Actor);
 	}
 }
 
@@ -169,67 +190,310 @@ void UKRollBindingWorldSubsystem::Deinitialize()
 	if (UWorld* World = GetWorld())
 	{
 		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+
+		if (UGameInstance* GI = World->GetGameInstance())
+		{
+			GI->GetOnPawnControllerChanged().RemoveDynamic(this, &UKRollBindingWorldSubsystem::HandlePawnControllerChanged);
+		}
 	}
 
 	if (KRoll)
 	{
 		KRoll->OnConfigReady.RemoveDynamic(this, &UKRollBindingWorldSubsystem::OnConfigReady);
+		KRoll->Unsubscribe(KeysChangedHandle);
 	}
+	KeysChangedHandle.Reset();
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LevelRemovedHandle.Reset();
 
 	DeferredActors.Empty();
+	PendingActors.Empty();
+	PendingHead = 0;
+	QueuedActors.Empty();
+	PendingNudges.Empty();
+	PendingSeededSets = 0;
+	QueueStats = FKRollBindingQueueStats();
+	BoundByKey.Empty();
+	BoundByActor.Empty();
+	ActorContexts.Empty();
 	Cache.Reset();
 	KRoll = nullptr;
 
 	Super::Deinitialize();
 }
 
+void UKRollBindingWorldSubsystem::Tick(float DeltaTime)
+{
+	DrainQueue();
+	FlushNudges();
+}
+
+TStatId UKRollBindingWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UKRollBindingWorldSubsystem, STATGROUP_Tickables);
+}
+
+bool UKRollBindingWorldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Editor and preview worlds have no game instance to read config from, and are never ticked
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
 void UKRollBindingWorldSubsystem::HandleActorSpawned(AActor* Actor)
 {
-	if (!Actor || !Actor->HasAuthority())
+	if (!KRoll || !Actor || !Actor->HasAuthority())
 	{
 		return;
 	}
 
-	ScheduleInitNextTick(Actor);
+	// Most spawns (projectiles, effects, ...) have nothing bound; drop them before the queue
+	if (!HasBindingWork(Actor))
+	{
+		++QueueStats.SkippedSpawns;
+		return;
+	}
+
+	EnqueueActor(Actor);
+}
+
+bool UKRollBindingWorldSubsystem::HasBindingWork(AActor* Actor) const
+{
+	const FKRollClassBindings& Bindings = Cache->GetOrBuildActorBindings(Actor->GetClass());
+	if (Bindings.bHasActorBindings || Bindings.bHasComponentBindings)
+	{
+		return true;
+	}
+
+	// Another instance already showed that this class's attribute sets bind nothing
+	if (Bindings.bNoAttributeBindings)
+	{
+		return false;
+	}
+
+	if (Bindings.bIsAbilitySystemContext)
+	{
+		return true;
+	}
+
+	// An ASC added to an otherwise plain actor still carries attribute sets
+	return Actor->FindComponentByClass<UAbilitySystemComponent>() != nullptr;
 }
 
-void UKRollBindingWorldSubsystem::ScheduleInitNextTick(AActor* Actor)
+void UKRollBindingWorldSubsystem::EnqueueActor(AActor* Actor)
 {
 	if (!Actor)
 	{
 		return;
 	}
 
-	TWeakObjectPtr<AActor> WeakActor = Actor;
-	if (UWorld* World = GetWorld())
+	bool bAlreadyQueued = false;
+	QueuedActors.Add(Actor, &bAlreadyQueued);
+	if (bAlreadyQueued)
+	{
+		return;
+	}
+
+	FPendingActor& Pending = PendingActors.AddDefaulted_GetRef();
+	Pending.Actor = Actor;
+	Pending.EnqueuedAt = FPlatformTime::Seconds();
+
+	QueueStats.QueueDepth = QueuedActors.Num();
+	QueueStats.PeakQueueDepth = FMath::Max(QueueStats.PeakQueueDepth, QueueStats.QueueDepth);
+}
+
+void UKRollBindingWorldSubsystem::DrainQueue()
+{
+	QueueStats.ProcessedLastFrame = 0;
+	QueueStats.DrainMsLastFrame = 0.0;
+	QueueStats.AverageLatencyMs = 0.0;
+	QueueStats.MaxLatencyMs = 0.0;
+
+	if (PendingHead >= PendingActors.Num())
+	{
+		return;
+	}
+
+	const double BudgetSeconds = GetDefault<UKRollSettings>()->BindingApplyBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	double LatencySum = 0.0;
+	int32 Processed = 0;
+
+	while (PendingHead < PendingActors.Num())
+	{
+		// Always make progress, even if a single actor costs more than the whole budget
+		const double Now = FPlatformTime::Seconds();
+		if (Processed > 0 && BudgetSeconds > 0.0 && Now - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		const FPendingActor Pending = PendingActors[PendingHead++];
+
+		// Entries that were applied manually or destroyed since being queued are no longer in the set
+		if (QueuedActors.Remove(Pending.Actor) == 0)
+		{
+			continue;
+		}
+
+		AActor* Actor = Pending.Actor.ResolveObjectPtr();
+		if (!Actor || !Actor->HasAuthority())
+		{
+			continue;
+		}
+
+		TryInitActorNow(Actor);
+
+		const double LatencyMs = (Now - Pending.EnqueuedAt) * 1000.0;
+		LatencySum += LatencyMs;
+		QueueStats.MaxLatencyMs = FMath::Max(QueueStats.MaxLatencyMs, LatencyMs);
+		++Processed;
+	}
+
+	// Reclaim the processed prefix once it dominates the array
+	if (PendingHead >= PendingActors.Num())
+	{
+		PendingActors.Reset();
+		PendingHead = 0;
+	}
+	else if (PendingHead > 64 && PendingHead * 2 > PendingActors.Num())
 	{
-		World->GetTimerManager().SetTimerForNextTick([this, WeakActor]()
-													 {
-														 AActor* A = WeakActor.Get();
-														 if (!A || !A->HasAuthority())
-														 {
-															 return;
-														 }
-														 TryInitActorNow(A);
-													 });
+#if UE_VERSION_NEWER_THAN_OR_EQUAL(5, 4, 0)
+		PendingActors.RemoveAt(0, PendingHead, EAllowShrinking::No);
+#else
+		PendingActors.RemoveAt(0, PendingHead, /*bAllowShrinking*/ false);
+#endif
+		PendingHead = 0;
+	}
+
+	QueueStats.QueueDepth = QueuedActors.Num();
+	QueueStats.ProcessedLastFrame = Processed;
+	QueueStats.TotalProcessed += Processed;
+	QueueStats.DrainMsLastFrame = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	QueueStats.AverageLatencyMs = Processed > 0 ? LatencySum / Processed : 0.0;
+}
+
+void UKRollBindingWorldSubsystem::QueueNudge(UAbilitySystemComponent* ASC)
+{
+	PendingNudges.Add(ASC);
+	++PendingSeededSets;
+}
+
+void UKRollBindingWorldSubsystem::FlushNudges()
+{
+	if (PendingNudges.IsEmpty())
+	{
+		return;
+	}
+
+	int32 Issued = 0;
+	for (const TObjectKey<UAbilitySystemComponent>& ASC : PendingNudges)
+	{
+		if (UAbilitySystemComponent* Resolved = ASC.ResolveObjectPtr())
+		{
+			FKRollBindingApplier::NudgeReplication(Resolved);
+			++Issued;
+		}
 	}
+
+	QueueStats.ReplicationNudges += Issued;
+	QueueStats.NudgesAvoided += FMath::Max(PendingSeededSets - Issued, 0);
+
+	PendingNudges.Reset();
+	PendingSeededSets = 0;
 }
 
 void UKRollBindingWorldSubsystem::TryInitActorNow(AActor* Actor)
 {
-	if (!Actor || !KRoll || !Cache.IsValid())
+	if (Actor)
+	{
+		ApplyActors(MakeArrayView(&Actor, 1));
+	}
+}
+
+void UKRollBindingWorldSubsystem::ApplyActors(TConstArrayView<AActor*> Actors)
+{
+	if (Actors.IsEmpty() || !KRoll || !Cache.IsValid())
 	{
 		return;
 	}
 
 	if (!KRoll->IsReady())
 	{
-		DeferredActors.Add(Actor);
+		for (AActor* Actor : Actors)
+		{
+			DeferredActors.Add(Actor);
+		}
 		return;
 	}
 
-	ApplyActorAndComponents(Actor);
-	ApplyAttributeSets(Actor);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Gather (game thread): binding lists and targets; class caches are built here
+	TArray<FKRollBindingTarget> Targets;
+	Targets.Reserve(Actors.Num() * 4);
+
+	for (AActor* Actor : Actors)
+	{
+		// A re-apply resolves keys again (archetype or possession may have changed)
+		UnregisterActor(Actor);
+		GatherTargets(Actor, Targets);
+	}
+
+	// Resolve (any thread): keys and values into the staging plans; reads objects, writes none
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	const bool bParallel = Settings->bParallelBindingResolve && Targets.Num() >= Settings->ParallelResolveMinTargets;
+
+	FKRollBindingCache& PlanCache = *Cache;
+	const UKRollSubsystem* KRollSubsystem = KRoll;
+	ParallelFor(Targets.Num(), [&Targets, &PlanCache, KRollSubsystem](int32 Index)
+	{
+		FKRollBindingTarget& It = Targets[Index];
+		It.Plan = &PlanCache.GetOrBuildPlan(*It.Bindings, It.Target, It.KeyContext, KRollSubsystem);
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	const double ResolvedAt = FPlatformTime::Seconds();
+
+	// Commit (game thread): property writes and registration; seeded ASCs are nudged at the end of the frame
+	const bool bSeedWithEffect = Settings->AttributeSeedMode == EKRollAttributeSeedMode::GameplayEffect;
+
+	for (const FKRollBindingTarget& It : Targets)
+	{
+		if (It.ASC)
+		{
+			const bool bSeeded = bSeedWithEffect
+				? FKRollBindingApplier::ApplySeedEffect(It.ASC, Cache->GetOrBuildSeedEffect(*It.Plan))
+				: FKRollBindingApplier::ApplyAttributePlan(CastChecked<UAttributeSet>(It.Target), *It.Plan);
+			if (bSeeded)
+			{
+				QueueNudge(It.ASC);
+			}
+		}
+		else
+		{
+			FKRollBindingApplier::ApplyPlan(It.Target, *It.Plan);
+		}
+		RegisterBoundProperties(It.Actor, It.Target, It.ASC, *It.Plan);
+	}
+
+	// Bound keys and cached contexts are dropped when the actor goes away
+	for (AActor* Actor : Actors)
+	{
+		if (BoundByActor.Contains(Actor) || ActorContexts.Contains(Actor))
+		{
+			Actor->OnDestroyed.AddUniqueDynamic(this, &UKRollBindingWorldSubsystem::HandleActorDestroyed);
+		}
+	}
+
+	if (Actors.Num() > 1)
+	{
+		QueueStats.LastBulkActors = Actors.Num();
+		QueueStats.LastBulkTargets = Targets.Num();
+		QueueStats.LastBulkResolveMs = (ResolvedAt - StartTime) * 1000.0;
+		QueueStats.LastBulkCommitMs = (FPlatformTime::Seconds() - ResolvedAt) * 1000.0;
+	}
 }
 
 void UKRollBindingWorldSubsystem::OnConfigReady()
@@ -239,16 +503,11 @@ void UKRollBindingWorldSubsystem::OnConfigReady()
 		return;
 	}
 
-	TArray<TWeakObjectPtr<AActor>> Work;
+	// Actors that arrived before the first snapshot are applied in one bulk pass
+	TArray<AActor*> Work;
 	Work.Reserve(DeferredActors.Num());
 
 	for (const TWeakObjectPtr<AActor>& W : DeferredActors)
-	{
-		Work.Add(W);
-	}
-	DeferredActors.Empty();
-
-	for (const TWeakObjectPtr<AActor>& W : Work)
 	{
 		AActor* Actor = W.Get();
 		if (!Actor || !Actor->HasAuthority())
@@ -256,8 +515,14 @@ void UKRollBindingWorldSubsystem::OnConfigReady()
 			continue;
 		}
 
-		TryInitActorNow(Actor);
+		// Applied here; a pending queue entry for the same actor becomes a no-op
+		QueuedActors.Remove(Actor);
+		Work.Add(Actor);
 	}
+	DeferredActors.Empty();
+	QueueStats.QueueDepth = QueuedActors.Num();
+
+	ApplyActors(Work);
 }
 
 void UKRollBindingWorldSubsystem::ApplyManual(AActor* Actor)
@@ -267,56 +532,324 @@ void UKRollBindingWorldSubsystem::ApplyManual(AActor* Actor)
 		return;
 	}
 
+	// Applied now; a pending queue entry for the same actor becomes a no-op
+	QueuedActors.Remove(Actor);
+	QueueStats.QueueDepth = QueuedActors.Num();
+
+	// Callers re-apply after changing the actor (e.g. granting an ASC or attribute sets), so walk its
+	// context again and stop assuming its class binds no attributes
+	ActorContexts.Remove(Actor);
+	Cache->SetNoAttributeBindings(Actor->GetClass(), false);
+
 	TryInitActorNow(Actor);
 }
 
-void UKRollBindingWorldSubsystem::ApplyActorAndComponents(AActor* Actor)
+void UKRollBindingWorldSubsystem::GatherTargets(AActor* Actor, TArray<FKRollBindingTarget>& OutTargets)
 {
 	const FKRollClassBindings& Bindings = Cache->GetOrBuildActorBindings(Actor->GetClass());
 
-	FKRollBindingApplier::ApplyBindings(Actor, Bindings.ActorBindings, KRoll, Actor);
+	if (Bindings.bHasActorBindings)
+	{
+		FKRollBindingTarget& Target = OutTargets.AddDefaulted_GetRef();
+		Target.Target = Actor;
+		Target.Bindings = &Bindings.ActorBindings;
+		Target.KeyContext = Actor;
+		Target.Actor = Actor;
+	}
 
-	TArray<UActorComponent*> Components;
-	Actor->GetComponents(Components);
+	if (Bindings.bHasComponentBindings)
+	{
+		Actor->ForEachComponent(/*bIncludeFromChildActors*/ false, [Actor, &Bindings, &OutTargets](UActorComponent* Comp)
+		{
+			if (const TArray<FKRollPropertyBinding>* CompBindings = Bindings.ComponentBindings.Find(Comp->GetClass()))
+			{
+				FKRollBindingTarget& Target = OutTargets.AddDefaulted_GetRef();
+				Target.Target = Comp;
+				Target.Bindings = CompBindings;
+				Target.KeyContext = Actor;
+				Target.Actor = Actor;
+			}
+		});
+	}
+
+	if (Bindings.bNoAttributeBindings)
+	{
+		return;
+	}
 
-	for (UActorComponent* Comp : Components)
+	AActor* KeyContextActor = nullptr;
+	UAbilitySystemComponent* ASC = ResolveActorContext(Actor, Bindings, KeyContextActor);
+	if (!ASC)
 	{
-		if (!Comp)
+		return;
+	}
+
+	AActor* Context = KeyContextActor ? KeyContextActor : Actor;
+	const TArray<UAttributeSet*>& Sets = ASC->GetSpawnedAttributes();
+	bool bAnySetBindings = false;
+
+	for (UAttributeSet* Set : Sets)
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		const TArray<FKRollPropertyBinding>& SetBindings = Cache->GetOrBuildAttributeSetBindings(Set->GetClass());
+		if (SetBindings.IsEmpty())
 		{
 			continue;
 		}
+		bAnySetBindings = true;
+
+		FKRollBindingTarget& Target = OutTargets.AddDefaulted_GetRef();
+		Target.Target = Set;
+		Target.Bindings = &SetBindings;
+		Target.KeyContext = Context;
+		Target.Actor = Actor;
+		Target.ASC = ASC;
+	}
+
+	// An ASC without sets may not be initialised yet, so only a populated one settles the class
+	if (!bAnySetBindings && !Sets.IsEmpty())
+	{
+		Cache->SetNoAttributeBindings(Actor->GetClass(), true);
+	}
+}
+
+UAbilitySystemComponent* UKRollBindingWorldSubsystem::ResolveActorContext(
+	AActor* Actor,
+	const FKRollClassBindings& Bindings,
+	AActor*& OutKeyContext
+)
+{
+	OutKeyContext = nullptr;
 
-		if (const TArray<FKRollPropertyBinding>* CompBindings = Bindings.ComponentBindings.Find(Comp->GetClass()))
+	if (const FKRollActorContext* Cached = ActorContexts.Find(Actor))
+	{
+		UAbilitySystemComponent* ASC = Cached->ASC.Get();
+		AActor* KeyContext = Cached->KeyContext.Get();
+		if (ASC && KeyContext)
 		{
-			FKRollBindingApplier::ApplyBindings(Comp, *CompBindings, KRoll, Actor);
+			OutKeyContext = KeyContext;
+			return ASC;
 		}
+		ActorContexts.Remove(Actor);
+	}
+
+	// Only pawn-like actors, and actors carrying an ASC themselves, lead to attribute sets
+	UAbilitySystemComponent* ASC = nullptr;
+	if (Bindings.bIsAbilitySystemContext || Actor->FindComponentByClass<UAbilitySystemComponent>())
+	{
+		ASC = ResolveASCAndKeyContext(Actor, OutKeyContext);
 	}
+
+	// Misses are not cached: the ASC may be created or given its actor info later
+	if (ASC && OutKeyContext)
+	{
+		FKRollActorContext& Entry = ActorContexts.Add(Actor);
+		Entry.ASC = ASC;
+		Entry.KeyContext = OutKeyContext;
+	}
+	return ASC;
 }
 
-void UKRollBindingWorldSubsystem::ApplyAttributeSets(AActor* Actor)
+void UKRollBindingWorldSubsystem::HandlePawnControllerChanged(APawn* Pawn, AController* Controller)
 {
-	AActor* KeyContextActor = Actor;
-	UAbilitySystemComponent* ASC = ResolveASCAndKeyContext(Actor, KeyContextActor);
-	if (!ASC)
+	// Possession moves the ASC, player state and key context of the pawn, its old and new controller
+	// and their player states; it is rare enough to just forget every cached context
+	ActorContexts.Reset();
+}
+
+void UKRollBindingWorldSubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
 	{
 		return;
 	}
 
-	const TArray<UAttributeSet*>& Sets = ASC->GetSpawnedAttributes();
+	// Null when the whole world is being torn down
+	if (!Level)
+	{
+		ActorContexts.Reset();
+		BoundByKey.Reset();
+		BoundByActor.Reset();
+		return;
+	}
+
+	auto IsGoneOrInLevel = [Level](TObjectKey<AActor> ActorKey)
+	{
+		const AActor* Actor = ActorKey.ResolveObjectPtr();
+		return !Actor || Actor->GetLevel() == Level;
+	};
+
+	// Streamed-out actors are not destroyed, so OnDestroyed never cleans up after them
+	for (auto It = ActorContexts.CreateIterator(); It; ++It)
+	{
+		if (IsGoneOrInLevel(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<TObjectKey<AActor>> Unloaded;
+	for (const TPair<TObjectKey<AActor>, TArray<FKRollBoundRef>>& It : BoundByActor)
+	{
+		if (IsGoneOrInLevel(It.Key))
+		{
+			Unloaded.Add(It.Key);
+		}
+	}
+	for (const TObjectKey<AActor> ActorKey : Unloaded)
+	{
+		UnregisterActor(ActorKey);
+	}
+}
 
-	if (Sets.Num() == 0)
+void UKRollBindingWorldSubsystem::RegisterBoundProperties(
+	AActor* Actor,
+	UObject* Target,
+	UAbilitySystemComponent* ASC,
+	const FKRollBindingPlan& Plan
+)
+{
+	if (Plan.Entries.IsEmpty())
 	{
 		return;
 	}
 
-	for (UAttributeSet* Set : Sets)
+	TArray<FKRollBoundRef>& ActorRefs = BoundByActor.FindOrAdd(Actor);
+
+	for (const FKRollPlanEntry& It : Plan.Entries)
 	{
-		if (!Set)
+		TArray<FKRollBoundProperty>& Bucket = BoundByKey.FindOrAdd(It.Key);
+
+		FKRollBoundProperty& Bound = Bucket.AddDefaulted_GetRef();
+		Bound.Target = Target;
+		Bound.ASC = ASC;
+		Bound.Binding = It.Binding;
+		Bound.Owner = Actor;
+		Bound.OwnerSlot = ActorRefs.Num();
+		Bound.Generation = Plan.Generation;
+
+		ActorRefs.Add(FKRollBoundRef{ It.Key, Bucket.Num() - 1 });
+	}
+}
+
+void UKRollBindingWorldSubsystem::UnregisterActor(TObjectKey<AActor> ActorKey)
+{
+	TArray<FKRollBoundRef> ActorRefs;
+	if (!BoundByActor.RemoveAndCopyValue(ActorKey, ActorRefs))
+	{
+		return;
+	}
+
+	for (const FKRollBoundRef& Ref : ActorRefs)
+	{
+		TArray<FKRollBoundProperty>* Bucket = BoundByKey.Find(Ref.Key);
+		if (!Bucket || !Bucket->IsValidIndex(Ref.Index))
 		{
 			continue;
 		}
 
-		const TArray<FKRollPropertyBinding>& SetBindings = Cache->GetOrBuildAttributeSetBindings(Set->GetClass());
-		FKRollBindingApplier::ApplyAttributeSetBindings(Set, ASC, SetBindings, KRoll, KeyContextActor ? KeyContextActor : Actor);
+		// The last entry fills the freed slot; point its owner's ref at the new index
+		const int32 Last = Bucket->Num() - 1;
+		if (Ref.Index != Last)
+		{
+			const FKRollBoundProperty& Moved = (*Bucket)[Last];
+			TArray<FKRollBoundRef>* MovedRefs = Moved.Owner == ActorKey ? &ActorRefs : BoundByActor.Find(Moved.Owner);
+			if (MovedRefs && MovedRefs->IsValidIndex(Moved.OwnerSlot))
+			{
+				(*MovedRefs)[Moved.OwnerSlot].Index = Ref.Index;
+			}
+		}
+
+		Bucket->RemoveAtSwap(Ref.Index);
+		if (Bucket->IsEmpty())
+		{
+			BoundByKey.Remove(Ref.Key);
+		}
+	}
+}
+
+void UKRollBindingWorldSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	QueuedActors.Remove(Actor);
+	ActorContexts.Remove(Actor);
+	UnregisterActor(Actor);
+}
+
+void UKRollBindingWorldSubsystem::HandlePostGarbageCollect()
+{
+	if (Cache.IsValid())
+	{
+		Cache->PruneStaleClasses();
+	}
+}
+
+void UKRollBindingWorldSubsystem::HandleKeysChanged(TConstArrayView<FName> ChangedKeys)
+{
+	if (!KRoll || !KRoll->IsReady() || BoundByKey.IsEmpty())
+	{
+		return;
+	}
+
+	const uint32 Generation = KRoll->GetSnapshotGeneration();
+	const bool bSeedWithEffect = GetDefault<UKRollSettings>()->AttributeSeedMode == EKRollAttributeSeedMode::GameplayEffect;
+
+	// Effect seeding is batched per ASC, so each one gets a single spec however many attributes changed;
+	// ASCs with the same changes share one effect
+	TMap<TObjectKey<UAbilitySystemComponent>, TArray<FKRollPlanEntry>> SeedsByASC;
+
+	for (const FName Key : ChangedKeys)
+	{
+		TArray<FKRollBoundProperty>* Bound = BoundByKey.Find(Key);
+		if (!Bound)
+		{
+			continue;
+		}
+
+		for (FKRollBoundProperty& It : *Bound)
+		{
+			// Objects applied after the publish already hold the new value
+			if (It.Generation == Generation)
+			{
+				continue;
+			}
+
+			UObject* Target = It.Target.Get();
+			if (!Target)
+			{
+				continue; // unregistered when its actor is destroyed
+			}
+			It.Generation = Generation;
+
+			if (UAbilitySystemComponent* ASC = It.ASC.Get())
+			{
+				if (bSeedWithEffect)
+				{
+					FKRollPlanEntry& Seed = SeedsByASC.FindOrAdd(ASC).AddDefaulted_GetRef();
+					Seed.Binding = It.Binding;
+					Seed.Key = Key;
+				}
+				else if (FKRollBindingApplier::SeedAttribute(CastChecked<UAttributeSet>(Target), *It.Binding, Key, KRoll))
+				{
+					QueueNudge(ASC);
+				}
+			}
+			else
+			{
+				FKRollBindingApplier::ApplyResolvedBinding(Target, *It.Binding, Key, KRoll);
+			}
+		}
+	}
+
+	for (const TPair<TObjectKey<UAbilitySystemComponent>, TArray<FKRollPlanEntry>>& It : SeedsByASC)
+	{
+		UAbilitySystemComponent* ASC = It.Key.ResolveObjectPtr();
+		if (ASC && FKRollBindingApplier::ApplySeedEffect(ASC, Cache->GetOrBuildUpdateSeedEffect(It.Value, KRoll)))
+		{
+			QueueNudge(ASC);
+		}
 	}
 }
@@ -21,9 +21,10 @@ float UKRollBlueprintLibrary::GetNumber(const FString& Key, float DefaultValue)
     return (float)FKRollAPI::GetNumber(Key, DefaultValue);
 }
 
-FString UKRollBlueprintLibrary::GetJson(const FString& Key)
+namespace
+{
+FString SerializeJson(const TSharedPtr<FJsonValue>& Json)
 {
-    const TSharedPtr<FJsonValue> Json = FKRollAPI::GetJson(Key);
     if (!Json.IsValid())
         return TEXT("");
 
@@ -32,5 +33,29 @@ FString UKRollBlueprintLibrary::GetJson(const FString& Key)
     FJsonSerializer::Serialize(Json.ToSharedRef(), TEXT(""), Writer);
     return Out;
 }
+}
+
+FString UKRollBlueprintLibrary::GetJson(const FString& Key)
+{
+    return SerializeJson(FKRollAPI::GetJson(Key));
+}
+
+bool UKRollBlueprintLibrary::GetBoolByName(FName Key, bool DefaultValue)
+{
+    return FKRollAPI::GetBool(Key, DefaultValue);
+}
+
+FString UKRollBlueprintLibrary::GetStringByName(FName Key, const FString& DefaultValue)
+{
+    return FKRollAPI::GetString(Key, DefaultValue);
+}
 
+float UKRollBlueprintLibrary::GetNumberByName(FName Key, float DefaultValue)
+{
+    return (float)FKRollAPI::GetNumber(Key, DefaultValue);
+}
 
+FString UKRollBlueprintLibrary::GetJsonByName(FName Key)
+{
+    return SerializeJson(FKRollAPI::GetJson(Key));
+}
@@ -2,9 +2,53 @@
 
 #include "GameFramework/Actor.h"
 #include "Components/ActorComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Algo/Find.h"
 
-static constexpr TCHAR TOKEN_ARCHETYPE[] = TEXT("{archetype}");
-static constexpr TCHAR TOKEN_CLASS[]     = TEXT("{class}");
+namespace
+{
+struct FTokenName
+{
+	const TCHAR* Name;
+	EKRollKeyToken Token;
+};
+
+const FTokenName TokenNames[] =
+{
+	{ TEXT("archetype"), EKRollKeyToken::Archetype },
+	{ TEXT("class"),     EKRollKeyToken::Class },
+	{ TEXT("component"), EKRollKeyToken::Component },
+	{ TEXT("level"),     EKRollKeyToken::Level },
+};
+
+// Normalized names are pure functions of the class; cache them so {class} costs a map probe
+FRWLock ClassTokenLock;
+TMap<TWeakObjectPtr<const UClass>, FString> ClassTokens;
+
+// Convention-based property: optional UPROPERTY(EditDefaultsOnly) FName KRollArchetype;
+// FindPropertyByName walks the class chain, so the result (including "none") is cached per class.
+FRWLock ArchetypePropertyLock;
+TMap<TWeakObjectPtr<const UClass>, const FNameProperty*> ArchetypeProperties;
+
+const FNameProperty* FindArchetypeProperty(const UClass* Class)
+{
+	{
+		FReadScopeLock ReadLock(ArchetypePropertyLock);
+		if (const FNameProperty* const* Found = ArchetypeProperties.Find(Class))
+		{
+			return *Found;
+		}
+	}
+
+	const FNameProperty* NameProp = CastField<FNameProperty>(Class->FindPropertyByName(TEXT("KRollArchetype")));
+
+	FWriteScopeLock WriteLock(ArchetypePropertyLock);
+	ArchetypeProperties.Add(Class, NameProp);
+	return NameProp;
+}
+}
 
 const AActor* FKRollKeyResolver::ResolveOwningActor(const UObject* Target)
 {
@@ -48,16 +92,7 @@ bool FKRollKeyResolver::TryGetArchetypeFromActor(const AActor* Actor, FString& O
 		return false;
 	}
 
-	// Convention-based property lookup: optional UPROPERTY(EditDefaultsOnly) FName KRollArchetype;
-	const FProperty* Prop = Actor->GetClass()->FindPropertyByName(TEXT("KRollArchetype"));
-	const FNameProperty* NameProp = CastField<FNameProperty>(Prop);
-	if (!NameProp)
-	{
-		return false;
-	}
-
-	const void* ValuePtr = NameProp->ContainerPtrToValuePtr<void>(Actor);
-	const FName Archetype = NameProp->GetPropertyValue(ValuePtr);
+	const FName Archetype = GetArchetypeName(Actor);
 	if (Archetype.IsNone())
 	{
 		return false;
@@ -67,6 +102,23 @@ bool FKRollKeyResolver::TryGetArchetypeFromActor(const AActor* Actor, FString& O
 	return !OutLower.IsEmpty();
 }
 
+FName FKRollKeyResolver::GetArchetypeName(const UObject* Target)
+{
+	const AActor* Actor = ResolveOwningActor(Target);
+	if (!Actor)
+	{
+		return NAME_None;
+	}
+
+	const FNameProperty* NameProp = FindArchetypeProperty(Actor->GetClass());
+	if (!NameProp)
+	{
+		return NAME_None;
+	}
+
+	return NameProp->GetPropertyValue(NameProp->ContainerPtrToValuePtr<void>(Actor));
+}
+
 FString FKRollKeyResolver::NormalizeClassName(FString In)
 {
 	// Conservative normalization (keep stable across refactors as much as possible)
@@ -89,7 +141,49 @@ FString FKRollKeyResolver::ResolveClassToken(const UObject* Target)
 		return TEXT("unknown");
 	}
 
-	return NormalizeClassName(Target->GetClass()->GetName());
+	const UClass* Class = Target->GetClass();
+	{
+		FReadScopeLock ReadLock(ClassTokenLock);
+		if (const FString* Found = ClassTokens.Find(Class))
+		{
+			return *Found;
+		}
+	}
+
+	FString Normalized = NormalizeClassName(Class->GetName());
+
+	FWriteScopeLock WriteLock(ClassTokenLock);
+	ClassTokens.Add(Class, Normalized);
+	return Normalized;
+}
+
+bool FKRollKeyResolver::ResolveComponentToken(const UObject* Target, FString& Out)
+{
+	const UActorComponent* Component = Cast<UActorComponent>(Target);
+	if (!Component)
+	{
+		return false;
+	}
+
+	// Blueprint-added components carry a template suffix on their CDO-derived names
+	Out = Component->GetName();
+	Out.RemoveFromEnd(TEXT("_GEN_VARIABLE"));
+	Out.ToLowerInline();
+	return !Out.IsEmpty();
+}
+
+bool FKRollKeyResolver::ResolveLevelToken(const UObject* Target, FString& Out)
+{
+	const AActor* Actor = ResolveOwningActor(Target);
+	const ULevel* Level = Actor ? Actor->GetLevel() : nullptr;
+	if (!Level)
+	{
+		return false;
+	}
+
+	Out = UWorld::RemovePIEPrefix(FPackageName::GetShortName(Level->GetOutermost()->GetName()));
+	Out.ToLowerInline();
+	return !Out.IsEmpty();
 }
 
 FString FKRollKeyResolver::ResolveArchetypeToken(const UObject* Target)
@@ -111,19 +205,126 @@ FString FKRollKeyResolver::ResolveArchetypeToken(const UObject* Target)
 	return ResolveClassToken(Target);
 }
 
-FName FKRollKeyResolver::ResolveKey(const UObject* Target, const FName& KeyTemplate)
+FKRollKeyTemplate FKRollKeyTemplate::Compile(const FString& Source, FString* OutError)
+{
+	FKRollKeyTemplate Template;
+
+	auto Fail = [&Template, OutError](const FString& Reason)
+	{
+		if (OutError)
+		{
+			*OutError = Reason;
+		}
+		Template.Segments.Reset();
+		Template.TokenMask = 0;
+		Template.bValid = false;
+		return Template;
+	};
+
+	if (Source.IsEmpty())
+	{
+		return Fail(TEXT("empty key"));
+	}
+
+	int32 Pos = 0;
+	while (Pos < Source.Len())
+	{
+		const int32 Open = Source.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+		const int32 LiteralEnd = Open == INDEX_NONE ? Source.Len() : Open;
+
+		const FString Literal = Source.Mid(Pos, LiteralEnd - Pos);
+		if (Literal.Contains(TEXT("}")))
+		{
+			return Fail(TEXT("unbalanced '}'"));
+		}
+		if (!Literal.IsEmpty())
+		{
+			Template.Segments.Add({ EKRollKeyToken::Literal, Literal });
+		}
+
+		if (Open == INDEX_NONE)
+		{
+			break;
+		}
+
+		const int32 Close = Source.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Open + 1);
+		if (Close == INDEX_NONE)
+		{
+			return Fail(TEXT("unbalanced '{'"));
+		}
+
+		const FString Name = Source.Mid(Open + 1, Close - Open - 1);
+		const FTokenName* Known = Algo::FindByPredicate(TokenNames, [&Name](const FTokenName& It)
+		{
+			return Name.Equals(It.Name, ESearchCase::IgnoreCase);
+		});
+		if (!Known)
+		{
+			return Fail(FString::Printf(TEXT("unknown token {%s}"), *Name));
+		}
+
+		Template.Segments.Add({ Known->Token, FString() });
+		Template.TokenMask |= uint8(1 << uint8(Known->Token));
+		Pos = Close + 1;
+	}
+
+	Template.bValid = true;
+	return Template;
+}
+
+FName FKRollKeyResolver::ResolveKey(const FKRollKeyTemplate& Template, const UObject* Target, const UObject* KeyContext)
 {
-	FString Key = KeyTemplate.ToString();
-	if (Key.IsEmpty())
+	if (!Template.IsValid())
 	{
 		return NAME_None;
 	}
 
-	const FString Archetype = ResolveArchetypeToken(Target);
-	const FString ClassTok  = ResolveClassToken(Target);
+	TStringBuilder<256> Key;
 
-	Key.ReplaceInline(TOKEN_ARCHETYPE, *Archetype, ESearchCase::IgnoreCase);
-	Key.ReplaceInline(TOKEN_CLASS, *ClassTok, ESearchCase::IgnoreCase);
+	for (const FKRollKeyTemplate::FSegment& Segment : Template.Segments)
+	{
+		switch (Segment.Token)
+		{
+			case EKRollKeyToken::Literal:
+				Key << Segment.Literal;
+				break;
+
+			case EKRollKeyToken::Archetype:
+				Key << ResolveArchetypeToken(KeyContext);
+				break;
+
+			case EKRollKeyToken::Class:
+				Key << ResolveClassToken(KeyContext);
+				break;
+
+			case EKRollKeyToken::Component:
+			{
+				FString Component;
+				if (!ResolveComponentToken(Target, Component))
+				{
+					return NAME_None;
+				}
+				Key << Component;
+				break;
+			}
+
+			case EKRollKeyToken::Level:
+			{
+				FString Level;
+				if (!ResolveLevelToken(KeyContext, Level))
+				{
+					return NAME_None;
+				}
+				Key << Level;
+				break;
+			}
+		}
+	}
+
+	return FName(Key.Len(), Key.GetData());
+}
 
-	return FName(*Key);
+FName FKRollKeyResolver::ResolveKey(const UObject* Target, const FName& KeyTemplate)
+{
+	return ResolveKey(FKRollKeyTemplate::Compile(KeyTemplate.ToString()), Target, Target);
 }
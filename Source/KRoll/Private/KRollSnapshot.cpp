@@ -0,0 +1,576 @@
+#include "KRollSnapshot.h"
+#include "KRollKeyHandle.h"
+#include "KRollUtf8.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include <atomic>
+
+namespace
+{
+using KRollUtf8::MakeName;
+using KRollUtf8::ToFString;
+
+// Process-wide so a generation never repeats across game instances (PIE, multi-instance servers)
+std::atomic<uint32> GNextSnapshotGeneration{1};
+
+bool TryCoerceStringToBool(const FString& In, bool& OutValue)
+{
+	if (In.Equals(TEXT("true"), ESearchCase::IgnoreCase) || In == TEXT("1")
+		|| In.Equals(TEXT("yes"), ESearchCase::IgnoreCase) || In.Equals(TEXT("y"), ESearchCase::IgnoreCase))
+	{
+		OutValue = true;
+		return true;
+	}
+	if (In.Equals(TEXT("false"), ESearchCase::IgnoreCase) || In == TEXT("0")
+		|| In.Equals(TEXT("no"), ESearchCase::IgnoreCase) || In.Equals(TEXT("n"), ESearchCase::IgnoreCase))
+	{
+		OutValue = false;
+		return true;
+	}
+	return false;
+}
+
+bool TryConvertNumberToInteger(double In, int64& OutValue)
+{
+	// Outside this range the conversion is undefined; treat as "no integer view"
+	static constexpr double MaxExactInt64 = 9223372036854774784.0;
+	if (!FMath::IsFinite(In) || In < -MaxExactInt64 || In > MaxExactInt64)
+	{
+		return false;
+	}
+
+	OutValue = FMath::RoundToInt64(In);
+	return true;
+}
+
+class FOwnedSnapshotStorage final : public IKRollSnapshotStorage
+{
+public:
+	explicit FOwnedSnapshotStorage(TArray64<uint8>&& InBytes) : Bytes(MoveTemp(InBytes)) {}
+
+	virtual TConstArrayView64<uint8> GetBytes() const override { return Bytes; }
+
+private:
+	TArray64<uint8> Bytes;
+};
+
+class FMappedSnapshotStorage final : public IKRollSnapshotStorage
+{
+public:
+	FMappedSnapshotStorage(TUniquePtr<IMappedFileHandle>&& InHandle, TUniquePtr<IMappedFileRegion>&& InRegion)
+		: Handle(MoveTemp(InHandle))
+		, Region(MoveTemp(InRegion))
+	{
+	}
+
+	virtual TConstArrayView64<uint8> GetBytes() const override
+	{
+		return TConstArrayView64<uint8>(Region->GetMappedPtr(), Region->GetMappedSize());
+	}
+
+private:
+	// Declaration order matters: the region must be unmapped before the handle closes
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+};
+
+// Appends UTF-8 strings to the pool while the blob is being built
+struct FPoolWriter
+{
+	TArray<uint8> Bytes;
+
+	// Set once the pool would no longer fit in a blob; further strings are dropped
+	bool bOverflow = false;
+
+	FKRollBlobString Add(const FString& Str)
+	{
+		FKRollBlobString Out;
+		if (Str.IsEmpty() || bOverflow)
+		{
+			return Out;
+		}
+
+		const FTCHARToUTF8 Converted(*Str, Str.Len());
+		if (uint64(Bytes.Num()) + uint64(Converted.Length()) > uint64(MAX_int32))
+		{
+			bOverflow = true;
+			return Out;
+		}
+
+		Out.Offset = uint32(Bytes.Num());
+		Out.Len = uint32(Converted.Length());
+		Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+		return Out;
+	}
+};
+
+bool IsSectionValid(const FKRollBlobHeader& Header, uint64 Offset, uint64 Count, uint64 ElementSize, uint64 Alignment)
+{
+	return Offset >= sizeof(FKRollBlobHeader)
+		&& Offset % Alignment == 0
+		&& Offset + Count * ElementSize <= Header.BlobSize;
+}
+
+bool SetError(FString* OutError, const TCHAR* Reason)
+{
+	if (OutError)
+	{
+		*OutError = Reason;
+	}
+	return false;
+}
+}
+
+FKRollValueSlot FKRollValueSlot::MakeBool(bool Value, bool bAllowTypeCoercion)
+{
+	FKRollValueSlot Slot;
+	Slot.Type = EJson::Boolean;
+	Slot.BoolValue = Value;
+	Slot.Available |= EKRollSlotFlags::Bool;
+
+	if (bAllowTypeCoercion)
+	{
+		Slot.NumberValue = Value ? 1.0 : 0.0;
+		Slot.IntegerValue = Value ? 1 : 0;
+		Slot.StringValue = Value ? TEXT("true") : TEXT("false");
+		Slot.Available |= EKRollSlotFlags::Number | EKRollSlotFlags::Integer | EKRollSlotFlags::String;
+	}
+	return Slot;
+}
+
+FKRollValueSlot FKRollValueSlot::MakeNumber(double Value, bool bAllowTypeCoercion)
+{
+	FKRollValueSlot Slot;
+	Slot.Type = EJson::Number;
+	Slot.NumberValue = Value;
+	Slot.Available |= EKRollSlotFlags::Number;
+
+	if (TryConvertNumberToInteger(Value, Slot.IntegerValue))
+	{
+		Slot.Available |= EKRollSlotFlags::Integer;
+	}
+
+	if (bAllowTypeCoercion)
+	{
+		Slot.BoolValue = (Value != 0.0);
+		Slot.StringValue = FString::SanitizeFloat(Value);
+		Slot.Available |= EKRollSlotFlags::Bool | EKRollSlotFlags::String;
+	}
+	return Slot;
+}
+
+FKRollValueSlot FKRollValueSlot::MakeString(FString&& Value, bool bAllowTypeCoercion)
+{
+	FKRollValueSlot Slot;
+	Slot.Type = EJson::String;
+	Slot.StringValue = MoveTemp(Value);
+	Slot.Available |= EKRollSlotFlags::String;
+
+	if (bAllowTypeCoercion)
+	{
+		if (TryCoerceStringToBool(Slot.StringValue, Slot.BoolValue))
+		{
+			Slot.Available |= EKRollSlotFlags::Bool;
+		}
+
+		double Parsed = 0.0;
+		if (LexTryParseString(Parsed, *Slot.StringValue))
+		{
+			Slot.NumberValue = Parsed;
+			Slot.Available |= EKRollSlotFlags::Number;
+
+			if (TryConvertNumberToInteger(Parsed, Slot.IntegerValue))
+			{
+				Slot.Available |= EKRollSlotFlags::Integer;
+			}
+		}
+	}
+	return Slot;
+}
+
+FKRollValueSlot FKRollValueSlot::MakeNull()
+{
+	FKRollValueSlot Slot;
+	Slot.Type = EJson::Null;
+	return Slot;
+}
+
+FKRollValueSlot FKRollValueSlot::MakeRawJson(EJson Type, FString&& Text)
+{
+	// Arrays/objects are only reachable through GetJson()
+	FKRollValueSlot Slot;
+	Slot.Type = Type;
+	Slot.RawJson = MoveTemp(Text);
+	return Slot;
+}
+
+FKRollSnapshotPtr FKRollSnapshot::Build(TMap<FName, FKRollValueSlot>&& Values, const FKRollSnapshotMeta* InMeta, bool bAllowTypeCoercion, FString* OutError)
+{
+	const uint32 NumEntries = uint32(Values.Num());
+	const uint64 NumBuckets64 = FMath::RoundUpToPowerOfTwo64(FMath::Max(uint64(NumEntries) * 2, uint64(2)));
+
+	// Section offsets are 32-bit and blobs are checksummed in one pass; refuse anything larger
+	const uint64 FixedSize = sizeof(FKRollBlobHeader)
+		+ uint64(NumEntries) * (sizeof(uint64) + sizeof(double) + sizeof(int64) + sizeof(FKRollBlobEntry))
+		+ NumBuckets64 * sizeof(uint32);
+	if (FixedSize > uint64(MAX_int32))
+	{
+		SetError(OutError, TEXT("too many values for a snapshot blob"));
+		return nullptr;
+	}
+	const uint32 NumBuckets = uint32(NumBuckets64);
+
+	FKRollBlobHeader Header;
+	Header.Flags = (InMeta ? FKRollBlobHeader::FlagHasMeta : 0) | (bAllowTypeCoercion ? FKRollBlobHeader::FlagTypeCoercion : 0);
+	Header.NumEntries = NumEntries;
+	Header.NumBuckets = NumBuckets;
+	Header.KeyHashesOffset = sizeof(FKRollBlobHeader);
+	Header.NumbersOffset = Header.KeyHashesOffset + NumEntries * sizeof(uint64);
+	Header.IntegersOffset = Header.NumbersOffset + NumEntries * sizeof(double);
+	Header.EntriesOffset = Header.IntegersOffset + NumEntries * sizeof(int64);
+	Header.BucketsOffset = Header.EntriesOffset + NumEntries * sizeof(FKRollBlobEntry);
+	Header.PoolOffset = Header.BucketsOffset + NumBuckets * sizeof(uint32);
+
+	TArray<uint64> KeyHashes;
+	TArray<double> Numbers;
+	TArray<int64> Integers;
+	TArray<FKRollBlobEntry> Entries;
+	TArray<uint32> Buckets;
+	KeyHashes.Reserve(NumEntries);
+	Numbers.Reserve(NumEntries);
+	Integers.Reserve(NumEntries);
+	Entries.Reserve(NumEntries);
+	Buckets.SetNumZeroed(NumBuckets);
+
+	FPoolWriter Pool;
+
+	for (TPair<FName, FKRollValueSlot>& It : Values)
+	{
+		const FKRollValueSlot& Slot = It.Value;
+
+		FKRollBlobEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Key = Pool.Add(It.Key.ToString());
+		Entry.Text = Pool.Add(Slot.Has(EKRollSlotFlags::String) ? Slot.StringValue : Slot.RawJson);
+		Entry.Type = uint8(Slot.Type);
+		Entry.Available = uint8(Slot.Available);
+		Entry.BoolValue = Slot.BoolValue ? 1 : 0;
+
+		const uint64 KeyHash = FKRollKeyHash::Compute(Pool.Bytes.GetData() + Entry.Key.Offset, int32(Entry.Key.Len));
+		KeyHashes.Add(KeyHash);
+		Numbers.Add(Slot.NumberValue);
+		Integers.Add(Slot.IntegerValue);
+
+		// Keys are unique (they came from a map), so the probe always ends on an empty bucket
+		uint32 Bucket = uint32(KeyHash) & (NumBuckets - 1);
+		while (Buckets[Bucket] != 0)
+		{
+			Bucket = (Bucket + 1) & (NumBuckets - 1);
+		}
+		Buckets[Bucket] = uint32(Entries.Num());
+	}
+	Values.Empty();
+
+	if (InMeta)
+	{
+		Header.SchemaVersion = InMeta->SchemaVersion;
+		Header.PublishedAtTicks = InMeta->PublishedAt.GetTicks();
+		Header.SnapshotId = Pool.Add(InMeta->ActiveSnapshotId);
+		Header.SnapshotHash = Pool.Add(InMeta->ActiveSnapshotHash);
+		Header.Label = Pool.Add(InMeta->Label);
+	}
+
+	Header.PoolSize = uint32(Pool.Bytes.Num());
+	Header.BlobSize = uint64(Header.PoolOffset) + Header.PoolSize;
+	if (Pool.bOverflow || Header.BlobSize > uint64(MAX_int32))
+	{
+		SetError(OutError, TEXT("snapshot blob would exceed 2 GiB"));
+		return nullptr;
+	}
+
+	TArray64<uint8> Blob;
+	Blob.SetNumUninitialized(Header.BlobSize);
+
+	uint8* Dest = Blob.GetData();
+	FMemory::Memcpy(Dest + Header.KeyHashesOffset, KeyHashes.GetData(), KeyHashes.Num() * sizeof(uint64));
+	FMemory::Memcpy(Dest + Header.NumbersOffset, Numbers.GetData(), Numbers.Num() * sizeof(double));
+	FMemory::Memcpy(Dest + Header.IntegersOffset, Integers.GetData(), Integers.Num() * sizeof(int64));
+	FMemory::Memcpy(Dest + Header.EntriesOffset, Entries.GetData(), Entries.Num() * sizeof(FKRollBlobEntry));
+	FMemory::Memcpy(Dest + Header.BucketsOffset, Buckets.GetData(), Buckets.Num() * sizeof(uint32));
+	FMemory::Memcpy(Dest + Header.PoolOffset, Pool.Bytes.GetData(), Pool.Bytes.Num());
+
+	Header.Crc = FCrc::MemCrc32(Dest + sizeof(FKRollBlobHeader), int32(Header.BlobSize - sizeof(FKRollBlobHeader)));
+	FMemory::Memcpy(Dest, &Header, sizeof(FKRollBlobHeader));
+
+	return FromBytes(MoveTemp(Blob), OutError);
+}
+
+FKRollSnapshotPtr FKRollSnapshot::FromStorage(TUniquePtr<IKRollSnapshotStorage>&& InStorage, FString* OutError)
+{
+	if (!InStorage.IsValid())
+	{
+		SetError(OutError, TEXT("no storage"));
+		return nullptr;
+	}
+
+	TSharedPtr<FKRollSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShareable(new FKRollSnapshot());
+	if (!Snapshot->Attach(MoveTemp(InStorage), OutError))
+	{
+		return nullptr;
+	}
+	return Snapshot;
+}
+
+FKRollSnapshotPtr FKRollSnapshot::FromBytes(TArray64<uint8>&& Bytes, FString* OutError)
+{
+	return FromStorage(MakeUnique<FOwnedSnapshotStorage>(MoveTemp(Bytes)), OutError);
+}
+
+FKRollSnapshotPtr FKRollSnapshot::FromFile(const FString& Path, FString* OutError)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(*Path));
+	if (Handle.IsValid() && Handle->GetFileSize() > 0)
+	{
+		TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, Handle->GetFileSize()));
+		if (Region.IsValid())
+		{
+			return FromStorage(MakeUnique<FMappedSnapshotStorage>(MoveTemp(Handle), MoveTemp(Region)), OutError);
+		}
+	}
+
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		SetError(OutError, TEXT("file not found"));
+		return nullptr;
+	}
+	return FromBytes(MoveTemp(Bytes), OutError);
+}
+
+bool FKRollSnapshot::Attach(TUniquePtr<IKRollSnapshotStorage>&& InStorage, FString* OutError)
+{
+	const TConstArrayView64<uint8> Bytes = InStorage->GetBytes();
+	if (Bytes.Num() < int64(sizeof(FKRollBlobHeader)))
+	{
+		return SetError(OutError, TEXT("truncated header"));
+	}
+	if (!IsAligned(Bytes.GetData(), alignof(uint64)))
+	{
+		return SetError(OutError, TEXT("misaligned blob"));
+	}
+
+	const FKRollBlobHeader& InHeader = *reinterpret_cast<const FKRollBlobHeader*>(Bytes.GetData());
+	if (InHeader.Magic != FKRollBlobHeader::MagicValue || InHeader.Version != FKRollBlobHeader::CurrentVersion)
+	{
+		return SetError(OutError, TEXT("unknown format"));
+	}
+	if (InHeader.BlobSize < sizeof(FKRollBlobHeader) || InHeader.BlobSize > uint64(Bytes.Num()) || InHeader.BlobSize > MAX_int32)
+	{
+		return SetError(OutError, TEXT("truncated blob"));
+	}
+	if (FCrc::MemCrc32(Bytes.GetData() + sizeof(FKRollBlobHeader), int32(InHeader.BlobSize - sizeof(FKRollBlobHeader))) != InHeader.Crc)
+	{
+		return SetError(OutError, TEXT("checksum mismatch"));
+	}
+
+	const uint32 N = InHeader.NumEntries;
+	const uint32 B = InHeader.NumBuckets;
+	if (!FMath::IsPowerOfTwo(B) || B <= N
+		|| !IsSectionValid(InHeader, InHeader.KeyHashesOffset, N, sizeof(uint64), alignof(uint64))
+		|| !IsSectionValid(InHeader, InHeader.NumbersOffset, N, sizeof(double), alignof(double))
+		|| !IsSectionValid(InHeader, InHeader.IntegersOffset, N, sizeof(int64), alignof(int64))
+		|| !IsSectionValid(InHeader, InHeader.EntriesOffset, N, sizeof(FKRollBlobEntry), alignof(FKRollBlobEntry))
+		|| !IsSectionValid(InHeader, InHeader.BucketsOffset, B, sizeof(uint32), alignof(uint32))
+		|| !IsSectionValid(InHeader, InHeader.PoolOffset, InHeader.PoolSize, 1, 1))
+	{
+		return SetError(OutError, TEXT("bad section table"));
+	}
+
+	const uint8* Base = Bytes.GetData();
+	const FKRollBlobEntry* InEntries = reinterpret_cast<const FKRollBlobEntry*>(Base + InHeader.EntriesOffset);
+	const uint64* InKeyHashes = reinterpret_cast<const uint64*>(Base + InHeader.KeyHashesOffset);
+	const uint32* InBuckets = reinterpret_cast<const uint32*>(Base + InHeader.BucketsOffset);
+
+	auto IsPoolRangeValid = [&InHeader](const FKRollBlobString& Str)
+	{
+		return uint64(Str.Offset) + Str.Len <= InHeader.PoolSize;
+	};
+
+	if (!IsPoolRangeValid(InHeader.SnapshotId) || !IsPoolRangeValid(InHeader.SnapshotHash) || !IsPoolRangeValid(InHeader.Label))
+	{
+		return SetError(OutError, TEXT("bad meta strings"));
+	}
+
+	for (uint32 Bucket = 0; Bucket < B; ++Bucket)
+	{
+		if (InBuckets[Bucket] > N)
+		{
+			return SetError(OutError, TEXT("bad bucket"));
+		}
+	}
+
+	// From here on the blob is trusted; wire up the views
+	Data = Base;
+	Header = &InHeader;
+	KeyHashes = InKeyHashes;
+	Numbers = reinterpret_cast<const double*>(Base + InHeader.NumbersOffset);
+	Integers = reinterpret_cast<const int64*>(Base + InHeader.IntegersOffset);
+	Entries = InEntries;
+	Buckets = InBuckets;
+	Pool = reinterpret_cast<const UTF8CHAR*>(Base + InHeader.PoolOffset);
+
+	Keys.Reserve(N);
+	Index.Reserve(N);
+
+	for (uint32 EntryIndex = 0; EntryIndex < N; ++EntryIndex)
+	{
+		const FKRollBlobEntry& Entry = Entries[EntryIndex];
+		if (!IsPoolRangeValid(Entry.Key) || !IsPoolRangeValid(Entry.Text) || Entry.Key.Len == 0 || Entry.Type > uint8(EJson::Object))
+		{
+			return SetError(OutError, TEXT("bad entry"));
+		}
+
+		const FUtf8StringView KeyText = GetPoolString(Entry.Key);
+		if (KeyHashes[EntryIndex] != FKRollKeyHash::Compute(KeyText) || FindIndex(KeyHashes[EntryIndex], KeyText) != int32(EntryIndex))
+		{
+			return SetError(OutError, TEXT("key table mismatch"));
+		}
+
+		const FName Key = MakeName(KeyText);
+		if (Index.Contains(Key))
+		{
+			return SetError(OutError, TEXT("duplicate key"));
+		}
+		Keys.Add(Key);
+		Index.Add(Key, int32(EntryIndex));
+	}
+
+	// Converted once here so FString reads stay a copy, as they were before the blob format
+	Strings.SetNum(N);
+	for (uint32 EntryIndex = 0; EntryIndex < N; ++EntryIndex)
+	{
+		if (HasView(int32(EntryIndex), EKRollSlotFlags::String))
+		{
+			Strings[EntryIndex] = ToFString(GetPoolString(Entries[EntryIndex].Text));
+		}
+	}
+
+	bHasMeta = (InHeader.Flags & FKRollBlobHeader::FlagHasMeta) != 0;
+	if (bHasMeta)
+	{
+		Meta.SchemaVersion = InHeader.SchemaVersion;
+		Meta.ActiveSnapshotId = ToFString(GetPoolString(InHeader.SnapshotId));
+		Meta.ActiveSnapshotHash = ToFString(GetPoolString(InHeader.SnapshotHash));
+		Meta.Label = ToFString(GetPoolString(InHeader.Label));
+		Meta.PublishedAt = FDateTime(InHeader.PublishedAtTicks);
+	}
+
+	Storage = MoveTemp(InStorage);
+	Generation = GNextSnapshotGeneration.fetch_add(1);
+	return true;
+}
+
+int32 FKRollSnapshot::FindIndex(uint64 KeyHash, FUtf8StringView Key) const
+{
+	const uint32 Mask = Header->NumBuckets - 1;
+	uint32 Bucket = uint32(KeyHash) & Mask;
+
+	for (uint32 Probe = 0; Probe <= Mask; ++Probe)
+	{
+		const uint32 Stored = Buckets[Bucket];
+		if (Stored == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 SlotIndex = int32(Stored - 1);
+		if (KeyHashes[SlotIndex] == KeyHash && GetPoolString(Entries[SlotIndex].Key).Equals(Key, ESearchCase::IgnoreCase))
+		{
+			return SlotIndex;
+		}
+		Bucket = (Bucket + 1) & Mask;
+	}
+	return INDEX_NONE;
+}
+
+bool FKRollSnapshot::IsSameValue(int32 SlotIndex, const FKRollSnapshot& Other, int32 OtherIndex) const
+{
+	if (!IsValidIndex(SlotIndex) || !Other.IsValidIndex(OtherIndex))
+	{
+		return false;
+	}
+
+	const FKRollBlobEntry& A = Entries[SlotIndex];
+	const FKRollBlobEntry& B = Other.Entries[OtherIndex];
+
+	// Bitwise number compare: NaN payloads and -0.0 count as changes, which is what a listener wants
+	return A.Type == B.Type
+		&& A.Available == B.Available
+		&& A.BoolValue == B.BoolValue
+		&& FMemory::Memcmp(&Numbers[SlotIndex], &Other.Numbers[OtherIndex], sizeof(double)) == 0
+		&& Integers[SlotIndex] == Other.Integers[OtherIndex]
+		&& GetPoolString(A.Text).Equals(Other.GetPoolString(B.Text), ESearchCase::CaseSensitive);
+}
+
+
+TSharedPtr<FJsonValue> FKRollSnapshot::GetJson(int32 SlotIndex) const
+{
+	if (!IsValidIndex(SlotIndex))
+	{
+		return nullptr;
+	}
+
+	const FKRollBlobEntry& Entry = Entries[SlotIndex];
+	switch (static_cast<EJson>(Entry.Type))
+	{
+		case EJson::Boolean:
+			return MakeShared<FJsonValueBoolean>(Entry.BoolValue != 0);
+
+		case EJson::Number:
+			return MakeShared<FJsonValueNumber>(Numbers[SlotIndex]);
+
+		case EJson::String:
+			return MakeShared<FJsonValueString>(ToFString(GetPoolString(Entry.Text)));
+
+		case EJson::Null:
+			return MakeShared<FJsonValueNull>();
+
+		case EJson::Object:
+		case EJson::Array:
+		{
+			TSharedPtr<FJsonValue> Parsed;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ToFString(GetPoolString(Entry.Text)));
+			if (!FJsonSerializer::Deserialize(Reader, Parsed))
+			{
+				return nullptr;
+			}
+			return Parsed;
+		}
+
+		default:
+			return nullptr;
+	}
+}
+
+int32 FKRollKeyHandle::Resolve(const FKRollSnapshot& Snapshot) const
+{
+	const uint64 Generation = Snapshot.GetGeneration();
+
+	uint64 Packed = Cached.load(std::memory_order_relaxed);
+	if ((Packed >> 32) != Generation)
+	{
+		const int32 SlotIndex = Literal.Str
+			? Snapshot.FindIndex(Literal.Hash, FUtf8StringView(Literal.Str, Literal.Len))
+			: Snapshot.FindIndex(Key);
+		Packed = (Generation << 32) | uint64(uint32(SlotIndex + 1));
+		Cached.store(Packed, std::memory_order_relaxed);
+	}
+
+	return int32(uint32(Packed)) - 1;
+}
@@ -0,0 +1,56 @@
+#include "KRollSnapshotDiff.h"
+
+FKRollSnapshotDiff FKRollSnapshotDiff::Compute(const FKRollSnapshot* Old, const FKRollSnapshot& New)
+{
+	FKRollSnapshotDiff Diff;
+	Diff.FromGeneration = Old ? Old->GetGeneration() : 0;
+	Diff.ToGeneration = New.GetGeneration();
+
+	if (!Old)
+	{
+		Diff.Added.Reserve(New.Num());
+		for (int32 SlotIndex = 0; SlotIndex < New.Num(); ++SlotIndex)
+		{
+			Diff.Added.Add(New.GetKey(SlotIndex));
+		}
+		return Diff;
+	}
+
+	// Same content under a different generation (e.g. disk copy replaced by the network copy)
+	if (Old->HasMeta() && New.HasMeta() && !New.GetMeta().ActiveSnapshotHash.IsEmpty()
+		&& Old->GetMeta().ActiveSnapshotHash == New.GetMeta().ActiveSnapshotHash)
+	{
+		return Diff;
+	}
+
+	int32 NumMatched = 0;
+	for (int32 SlotIndex = 0; SlotIndex < New.Num(); ++SlotIndex)
+	{
+		const int32 OldIndex = Old->FindIndex(New.GetKeyHash(SlotIndex), New.GetKeyUtf8(SlotIndex));
+		if (OldIndex == INDEX_NONE)
+		{
+			Diff.Added.Add(New.GetKey(SlotIndex));
+			continue;
+		}
+
+		++NumMatched;
+		if (!New.IsSameValue(SlotIndex, *Old, OldIndex))
+		{
+			Diff.Changed.Add(New.GetKey(SlotIndex));
+		}
+	}
+
+	// Every old key was matched at most once, so equal counts mean nothing was removed
+	if (NumMatched != Old->Num())
+	{
+		for (int32 OldIndex = 0; OldIndex < Old->Num(); ++OldIndex)
+		{
+			if (New.FindIndex(Old->GetKeyHash(OldIndex), Old->GetKeyUtf8(OldIndex)) == INDEX_NONE)
+			{
+				Diff.Removed.Add(Old->GetKey(OldIndex));
+			}
+		}
+	}
+
+	return Diff;
+}
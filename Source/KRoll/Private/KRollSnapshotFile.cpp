@@ -0,0 +1,76 @@
+#include "KRollSnapshotFile.h"
+#include "KRollLog.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+FString FKRollSnapshotFile::GetDefaultPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("KRoll") / TEXT("Snapshot.bin");
+}
+
+bool FKRollSnapshotFile::Save(const FKRollSnapshot& Snapshot, const FString& Path)
+{
+	if (!Snapshot.HasMeta() || Snapshot.GetMeta().ActiveSnapshotHash.IsEmpty())
+	{
+		return false;
+	}
+
+	// The blob is the file format; it carries its own checksum
+	const TConstArrayView64<uint8> Blob = Snapshot.GetBlob();
+
+	// Write aside and move into place so a crash or a second game instance never leaves a torn file
+	const FString TempPath = FPaths::SetExtension(Path, FGuid::NewGuid().ToString() + TEXT(".tmp"));
+	if (!FFileHelper::SaveArrayToFile(Blob, *TempPath))
+	{
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*Path, *TempPath, /*bReplace*/ true))
+	{
+		IFileManager::Get().Delete(*TempPath);
+		return false;
+	}
+	return true;
+}
+
+FKRollSnapshotPtr FKRollSnapshotFile::Load(const FString& Path, bool bAllowTypeCoercion)
+{
+	if (!IFileManager::Get().FileExists(*Path))
+	{
+		return nullptr;
+	}
+
+	// Not FromFile(): a mapping would stay open for the snapshot's lifetime and make Save's replace fail
+	TArray64<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		UE_LOG(LogKRoll, Warning, TEXT("KRoll: could not read persisted snapshot %s"), *Path);
+		return nullptr;
+	}
+
+	FString Error;
+	const FKRollSnapshotPtr Snapshot = FKRollSnapshot::FromBytes(MoveTemp(Bytes), &Error);
+	if (!Snapshot.IsValid())
+	{
+		UE_LOG(LogKRoll, Warning, TEXT("KRoll: discarding persisted snapshot %s (%s)"), *Path, *Error);
+		return nullptr;
+	}
+
+	if (!Snapshot->HasMeta() || !Snapshot->GetMeta().IsValid() || Snapshot->GetMeta().ActiveSnapshotHash.IsEmpty())
+	{
+		UE_LOG(LogKRoll, Warning, TEXT("KRoll: discarding persisted snapshot %s (no snapshot hash)"), *Path);
+		return nullptr;
+	}
+
+	// Coerced views are baked into the blob; a policy change means waiting for the network copy
+	if (Snapshot->WasBuiltWithTypeCoercion() != bAllowTypeCoercion)
+	{
+		UE_LOG(LogKRoll, Log, TEXT("KRoll: discarding persisted snapshot %s (type coercion setting changed)"), *Path);
+		return nullptr;
+	}
+
+	return Snapshot;
+}
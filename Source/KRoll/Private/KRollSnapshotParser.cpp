@@ -0,0 +1,595 @@
+#include "KRollSnapshotParser.h"
+#include "KRollUtf8.h"
+
+namespace
+{
+using KRollUtf8::MakeName;
+using KRollUtf8::ToFString;
+
+/**
+	* Forward-only reader over UTF-8 JSON. Strings are returned as views into the source
+	* buffer when they contain no escapes, otherwise decoded into a reused scratch buffer.
+	*/
+class FEnvelopeReader
+{
+public:
+	FEnvelopeReader(const uint8* InData, int64 InNum, bool bInAllowTypeCoercion)
+		: Pos(InData)
+		, End(InData + InNum)
+		, bAllowTypeCoercion(bInAllowTypeCoercion)
+	{
+	}
+
+	bool ParseEnvelope(FKRollSnapshotParser::FResult& Out)
+	{
+		SkipBOM();
+		SkipWhitespace();
+
+		bool bHasValues = false;
+		const bool bOk = ParseObjectMembers([this, &Out, &bHasValues](FUtf8StringView Field)
+		{
+			if (Field == UTF8TEXTVIEW("values"))
+			{
+				bHasValues = (PeekChar() == '{') && ParseValues(Out.Values);
+				return bHasValues;
+			}
+			if (Field == UTF8TEXTVIEW("meta") && PeekChar() == '{')
+			{
+				return ParseMeta(Out.Meta);
+			}
+			return SkipValue();
+		});
+
+		if (!bOk || !bHasValues)
+		{
+			return false;
+		}
+
+		Out.bHasMeta = Out.Meta.IsValid();
+		if (!Out.bHasMeta)
+		{
+			Out.Meta = FKRollSnapshotMeta{};
+		}
+		return true;
+	}
+
+private:
+	const uint8* Pos;
+	const uint8* End;
+	bool bAllowTypeCoercion;
+
+	TArray<uint8> Scratch;
+
+	uint8 PeekChar() const { return Pos < End ? *Pos : 0; }
+
+	void SkipBOM()
+	{
+		if (End - Pos >= 3 && Pos[0] == 0xEF && Pos[1] == 0xBB && Pos[2] == 0xBF)
+		{
+			Pos += 3;
+		}
+	}
+
+	static bool IsWhitespace(uint8 C)
+	{
+		return C == ' ' || C == '\t' || C == '\n' || C == '\r';
+	}
+
+	void SkipWhitespace()
+	{
+		while (Pos < End && IsWhitespace(*Pos))
+		{
+			++Pos;
+		}
+	}
+
+	bool Consume(uint8 Expected)
+	{
+		SkipWhitespace();
+		if (Pos < End && *Pos == Expected)
+		{
+			++Pos;
+			return true;
+		}
+		return false;
+	}
+
+	// Calls MemberFn(FieldName) with the cursor on each member value; MemberFn must consume the value
+	template <typename FnType>
+	bool ParseObjectMembers(FnType&& MemberFn)
+	{
+		if (!Consume('{'))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if (Consume('}'))
+		{
+			return true;
+		}
+
+		TArray<uint8, TInlineAllocator<128>> FieldName;
+
+		for (;;)
+		{
+			SkipWhitespace();
+
+			FUtf8StringView Field;
+			if (!ReadString(Field))
+			{
+				return false;
+			}
+
+			// Escaped field names live in Scratch, which the value may reuse; copy those out
+			if (Scratch.Num() > 0 && Field.GetData() == reinterpret_cast<const UTF8CHAR*>(Scratch.GetData()))
+			{
+				FieldName.Reset();
+				FieldName.Append(Scratch.GetData(), Field.Len());
+				Field = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(FieldName.GetData()), FieldName.Num());
+			}
+
+			if (!Consume(':'))
+			{
+				return false;
+			}
+			SkipWhitespace();
+
+			if (!MemberFn(Field))
+			{
+				return false;
+			}
+
+			if (Consume(','))
+			{
+				continue;
+			}
+			return Consume('}');
+		}
+	}
+
+	bool ParseValues(TMap<FName, FKRollValueSlot>& OutValues)
+	{
+		return ParseObjectMembers([this, &OutValues](FUtf8StringView Key)
+		{
+			FKRollValueSlot Slot;
+			if (!ReadSlot(Slot))
+			{
+				return false;
+			}
+
+			if (!Key.IsEmpty())
+			{
+				OutValues.Add(MakeName(Key), MoveTemp(Slot));
+			}
+			return true;
+		});
+	}
+
+	bool ParseMeta(FKRollSnapshotMeta& OutMeta)
+	{
+		OutMeta = FKRollSnapshotMeta{};
+
+		return ParseObjectMembers([this, &OutMeta](FUtf8StringView Field)
+		{
+			if (Field == UTF8TEXTVIEW("schema_version") && PeekChar() != '"')
+			{
+				double Number = 0.0;
+				if (!ReadNumber(Number))
+				{
+					return SkipValue();
+				}
+				OutMeta.SchemaVersion = static_cast<int32>(Number);
+				return true;
+			}
+
+			FString* Target = nullptr;
+			if (Field == UTF8TEXTVIEW("active_snapshot_id"))
+			{
+				Target = &OutMeta.ActiveSnapshotId;
+			}
+			else if (Field == UTF8TEXTVIEW("active_snapshot_hash"))
+			{
+				Target = &OutMeta.ActiveSnapshotHash;
+			}
+			else if (Field == UTF8TEXTVIEW("label"))
+			{
+				Target = &OutMeta.Label;
+			}
+			else if (Field == UTF8TEXTVIEW("published_at") && PeekChar() == '"')
+			{
+				FUtf8StringView Text;
+				if (!ReadString(Text))
+				{
+					return false;
+				}
+				// If parse fails, keep default (min) and still treat meta as present.
+				FDateTime::ParseIso8601(*ToFString(Text), OutMeta.PublishedAt);
+				return true;
+			}
+
+			if (!Target || PeekChar() != '"')
+			{
+				return SkipValue();
+			}
+
+			FUtf8StringView Text;
+			if (!ReadString(Text))
+			{
+				return false;
+			}
+			*Target = ToFString(Text);
+			return true;
+		});
+	}
+
+	bool ReadSlot(FKRollValueSlot& OutSlot)
+	{
+		switch (PeekChar())
+		{
+			case '"':
+			{
+				FUtf8StringView Text;
+				if (!ReadString(Text))
+				{
+					return false;
+				}
+				OutSlot = FKRollValueSlot::MakeString(ToFString(Text), bAllowTypeCoercion);
+				return true;
+			}
+
+			case 't':
+			case 'f':
+			{
+				const bool bValue = (PeekChar() == 't');
+				if (!ReadLiteral(bValue ? UTF8TEXTVIEW("true") : UTF8TEXTVIEW("false")))
+				{
+					return false;
+				}
+				OutSlot = FKRollValueSlot::MakeBool(bValue, bAllowTypeCoercion);
+				return true;
+			}
+
+			case 'n':
+			{
+				if (!ReadLiteral(UTF8TEXTVIEW("null")))
+				{
+					return false;
+				}
+				OutSlot = FKRollValueSlot::MakeNull();
+				return true;
+			}
+
+			case '{':
+			case '[':
+			{
+				// Kept as text; only keys read through GetJson() ever get a DOM
+				const EJson Type = (PeekChar() == '{') ? EJson::Object : EJson::Array;
+				const uint8* Start = Pos;
+				if (!SkipComposite())
+				{
+					return false;
+				}
+				const FUtf8StringView Text(reinterpret_cast<const UTF8CHAR*>(Start), static_cast<int32>(Pos - Start));
+				OutSlot = FKRollValueSlot::MakeRawJson(Type, ToFString(Text));
+				return true;
+			}
+
+			default:
+			{
+				double Number = 0.0;
+				if (!ReadNumber(Number))
+				{
+					return false;
+				}
+				OutSlot = FKRollValueSlot::MakeNumber(Number, bAllowTypeCoercion);
+				return true;
+			}
+		}
+	}
+
+	bool ReadLiteral(FUtf8StringView Literal)
+	{
+		const int32 Len = Literal.Len();
+		if (End - Pos < Len || FMemory::Memcmp(Pos, Literal.GetData(), Len) != 0)
+		{
+			return false;
+		}
+		Pos += Len;
+		return true;
+	}
+
+	bool ReadNumber(double& OutValue)
+	{
+		// JSON grammar only: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+		const uint8* Start = Pos;
+		auto IsDigit = [this]() { return Pos < End && *Pos >= '0' && *Pos <= '9'; };
+		auto SkipDigits = [this, &IsDigit]()
+		{
+			const uint8* DigitsStart = Pos;
+			while (IsDigit())
+			{
+				++Pos;
+			}
+			return Pos > DigitsStart;
+		};
+
+		if (Pos < End && *Pos == '-')
+		{
+			++Pos;
+		}
+
+		if (Pos < End && *Pos == '0')
+		{
+			++Pos;
+		}
+		else if (!SkipDigits())
+		{
+			return false;
+		}
+
+		if (Pos < End && *Pos == '.')
+		{
+			++Pos;
+			if (!SkipDigits())
+			{
+				return false;
+			}
+		}
+
+		if (Pos < End && (*Pos == 'e' || *Pos == 'E'))
+		{
+			++Pos;
+			if (Pos < End && (*Pos == '+' || *Pos == '-'))
+			{
+				++Pos;
+			}
+			if (!SkipDigits())
+			{
+				return false;
+			}
+		}
+
+		// Anything but a delimiter right after the number ("1-2", "01", "1x") is malformed
+		if (Pos < End && *Pos != ',' && *Pos != '}' && *Pos != ']' && !IsWhitespace(*Pos))
+		{
+			return false;
+		}
+
+		const int64 Len = Pos - Start;
+		ANSICHAR Buffer[64];
+		if (Len >= UE_ARRAY_COUNT(Buffer))
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(Buffer, Start, Len);
+		Buffer[Len] = '\0';
+		OutValue = FCStringAnsi::Atod(Buffer);
+		return true;
+	}
+
+	bool ReadString(FUtf8StringView& OutText)
+	{
+		if (PeekChar() != '"')
+		{
+			return false;
+		}
+		++Pos;
+
+		// Fast path: no escapes, return a view into the source
+		const uint8* Start = Pos;
+		while (Pos < End && *Pos != '"' && *Pos != '\\')
+		{
+			++Pos;
+		}
+		if (Pos >= End)
+		{
+			return false;
+		}
+		if (*Pos == '"')
+		{
+			OutText = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Start), static_cast<int32>(Pos - Start));
+			++Pos;
+			return true;
+		}
+
+		// Slow path: decode escapes into Scratch
+		Scratch.Reset();
+		Scratch.Append(Start, static_cast<int32>(Pos - Start));
+
+		while (Pos < End)
+		{
+			const uint8 C = *Pos++;
+			if (C == '"')
+			{
+				OutText = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Scratch.GetData()), Scratch.Num());
+				return true;
+			}
+			if (C != '\\')
+			{
+				Scratch.Add(C);
+				continue;
+			}
+
+			if (Pos >= End)
+			{
+				return false;
+			}
+
+			const uint8 Escape = *Pos++;
+			switch (Escape)
+			{
+				case '"':  Scratch.Add('"');  break;
+				case '\\': Scratch.Add('\\'); break;
+				case '/':  Scratch.Add('/');  break;
+				case 'b':  Scratch.Add('\b'); break;
+				case 'f':  Scratch.Add('\f'); break;
+				case 'n':  Scratch.Add('\n'); break;
+				case 'r':  Scratch.Add('\r'); break;
+				case 't':  Scratch.Add('\t'); break;
+				case 'u':
+				{
+					uint32 CodePoint = 0;
+					if (!ReadHex4(CodePoint))
+					{
+						return false;
+					}
+
+					// Surrogate pair
+					if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+					{
+						uint32 Low = 0;
+						if (End - Pos < 2 || Pos[0] != '\\' || Pos[1] != 'u')
+						{
+							return false;
+						}
+						Pos += 2;
+						if (!ReadHex4(Low) || Low < 0xDC00 || Low > 0xDFFF)
+						{
+							return false;
+						}
+						CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+					}
+
+					AppendUtf8(CodePoint);
+					break;
+				}
+				default:
+					return false;
+			}
+		}
+
+		return false;
+	}
+
+	bool ReadHex4(uint32& OutValue)
+	{
+		if (End - Pos < 4)
+		{
+			return false;
+		}
+
+		OutValue = 0;
+		for (int32 Idx = 0; Idx < 4; ++Idx)
+		{
+			const uint8 C = *Pos++;
+			uint32 Digit = 0;
+			if (C >= '0' && C <= '9')      Digit = C - '0';
+			else if (C >= 'a' && C <= 'f') Digit = 10 + C - 'a';
+			else if (C >= 'A' && C <= 'F') Digit = 10 + C - 'A';
+			else return false;
+
+			OutValue = (OutValue << 4) | Digit;
+		}
+		return true;
+	}
+
+	void AppendUtf8(uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Scratch.Add(static_cast<uint8>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			Scratch.Add(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+			Scratch.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Scratch.Add(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+			Scratch.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Scratch.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Scratch.Add(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+			Scratch.Add(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Scratch.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Scratch.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+
+	bool SkipString()
+	{
+		++Pos; // opening quote
+		while (Pos < End)
+		{
+			const uint8 C = *Pos++;
+			if (C == '\\')
+			{
+				++Pos;
+			}
+			else if (C == '"')
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Skips a nested object/array by bracket depth. Inner syntax is validated later, if the
+	// value is ever parsed through GetJson().
+	bool SkipComposite()
+	{
+		int32 Depth = 0;
+		while (Pos < End)
+		{
+			const uint8 C = *Pos;
+			if (C == '"')
+			{
+				if (!SkipString())
+				{
+					return false;
+				}
+				continue;
+			}
+
+			++Pos;
+			if (C == '{' || C == '[')
+			{
+				++Depth;
+			}
+			else if (C == '}' || C == ']')
+			{
+				if (--Depth == 0)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	bool SkipValue()
+	{
+		switch (PeekChar())
+		{
+			case '"': return SkipString();
+			case '{':
+			case '[': return SkipComposite();
+			case 't': return ReadLiteral(UTF8TEXTVIEW("true"));
+			case 'f': return ReadLiteral(UTF8TEXTVIEW("false"));
+			case 'n': return ReadLiteral(UTF8TEXTVIEW("null"));
+			default:
+			{
+				double Ignored = 0.0;
+				return ReadNumber(Ignored);
+			}
+		}
+	}
+};
+}
+
+bool FKRollSnapshotParser::Parse(TConstArrayView<uint8> Utf8, bool bAllowTypeCoercion, FResult& Out)
+{
+	Out = FResult{};
+	if (Utf8.Num() == 0)
+	{
+		return false;
+	}
+
+	FEnvelopeReader Reader(Utf8.GetData(), Utf8.Num(), bAllowTypeCoercion);
+	return Reader.ParseEnvelope(Out);
+}
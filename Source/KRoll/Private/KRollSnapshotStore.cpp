@@ -0,0 +1,110 @@
+#include "KRollSnapshotStore.h"
+
+#include "HAL/PlatformProcess.h"
+
+FKRollSnapshotStore::FReadScope::FReadScope(const FKRollSnapshotStore& InStore)
+	: Store(InStore)
+{
+	Side = Store.ActiveSide.load() & 1u;
+	Store.Readers[Side].fetch_add(1);
+
+	// Loaded after registering, so a concurrent publish either waits for us or we see the new pointer
+	Snapshot = Store.Current.load();
+}
+
+FKRollSnapshotStore::FReadScope::~FReadScope()
+{
+	Store.Readers[Side].fetch_sub(1);
+}
+
+FKRollSnapshotStore::~FKRollSnapshotStore()
+{
+	Reset();
+}
+
+FKRollSnapshotPtr FKRollSnapshotStore::Pin() const
+{
+	FReadScope Scope(*this);
+	if (!Scope)
+	{
+		return nullptr;
+	}
+
+	// Safe: the store holds a strong ref to anything reachable from Current until the grace period ends
+	return Scope->AsShared();
+}
+
+void FKRollSnapshotStore::Publish(FKRollSnapshotPtr NewSnapshot)
+{
+	check(IsInGameThread());
+
+	Current.store(NewSnapshot.Get());
+
+	if (CurrentOwner.IsValid())
+	{
+		Retired.Add(MoveTemp(CurrentOwner));
+	}
+	CurrentOwner = MoveTemp(NewSnapshot);
+
+	Reclaim();
+}
+
+void FKRollSnapshotStore::Reclaim()
+{
+	check(IsInGameThread());
+
+	if (GraceBatch.Num() == 0)
+	{
+		if (Retired.Num() == 0)
+		{
+			return;
+		}
+
+		// Start a grace period for everything retired so far
+		GraceBatch = MoveTemp(Retired);
+		bSideDrained[0] = false;
+		bSideDrained[1] = false;
+	}
+
+	// A retired snapshot can only be held by a reader registered before it was retired.
+	// Once each side has been observed empty after that point, none can remain.
+	for (uint32 SideIdx = 0; SideIdx < 2; ++SideIdx)
+	{
+		if (!bSideDrained[SideIdx] && Readers[SideIdx].load() == 0)
+		{
+			bSideDrained[SideIdx] = true;
+		}
+	}
+
+	if (bSideDrained[0] && bSideDrained[1])
+	{
+		GraceBatch.Reset();
+		return;
+	}
+
+	// New readers keep joining the active side; flip once the other side is done so it can drain too
+	const uint32 Active = ActiveSide.load() & 1u;
+	if (!bSideDrained[Active] && bSideDrained[Active ^ 1u])
+	{
+		ActiveSide.fetch_add(1);
+	}
+}
+
+void FKRollSnapshotStore::Reset()
+{
+	Current.store(nullptr);
+	WaitForReaders();
+
+	CurrentOwner.Reset();
+	Retired.Reset();
+	GraceBatch.Reset();
+}
+
+void FKRollSnapshotStore::WaitForReaders() const
+{
+	// Only used on teardown; read scopes are short so this is a brief spin at most
+	while (Readers[0].load() != 0 || Readers[1].load() != 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+}
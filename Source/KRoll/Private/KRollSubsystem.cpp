@@ -1,36 +1,290 @@
 #include "KRollSubsystem.h"
 #include "KRollSettings.h"
 #include "KRollLog.h"
-
+#include "KRollSnapshotParser.h"
+#include "KRollSnapshotFile.h"
+#include "KRollSnapshotDiff.h"
+#include "KRollBindingManifest.h"
+#include "KRollAPI.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
 #include "HttpModule.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Tasks/Task.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+
+namespace
+{
+UE::Tasks::ETaskPriority ToTaskPriority(EKRollSnapshotBuildPriority Priority)
+{
+	switch (Priority)
+	{
+		case EKRollSnapshotBuildPriority::High:             return UE::Tasks::ETaskPriority::High;
+		case EKRollSnapshotBuildPriority::Normal:           return UE::Tasks::ETaskPriority::Normal;
+		case EKRollSnapshotBuildPriority::BackgroundHigh:   return UE::Tasks::ETaskPriority::BackgroundHigh;
+		case EKRollSnapshotBuildPriority::BackgroundLow:    return UE::Tasks::ETaskPriority::BackgroundLow;
+		case EKRollSnapshotBuildPriority::BackgroundNormal:
+		default:                                            return UE::Tasks::ETaskPriority::BackgroundNormal;
+	}
+}
+
+double ToMs(double Seconds)
+{
+	return Seconds * 1000.0;
+}
+
+// Strips weak prefix and quotes: W/"abc" -> abc
+FString NormalizeETag(FString ETag)
+{
+	ETag.TrimStartAndEndInline();
+	ETag.RemoveFromStart(TEXT("W/"));
+	ETag.TrimQuotesInline();
+	return ETag;
+}
+
+FString MakeFetchBody(const FKRollSnapshotMeta* CurrentMeta)
+{
+	if (!CurrentMeta)
+	{
+		return TEXT("{}");
+	}
+
+	FString Body;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Body);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("snapshot_id"), CurrentMeta->ActiveSnapshotId);
+	Writer->WriteValue(TEXT("snapshot_hash"), CurrentMeta->ActiveSnapshotHash);
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return Body;
+}
+
+const TCHAR* BinarySnapshotContentType = TEXT("application/x-kroll-snapshot");
+
+// Compression is negotiated with KRoll-specific headers so HTTP stacks that transparently
+// decode Content-Encoding never inflate the payload on the game thread.
+const TCHAR* AcceptEncodingHeader      = TEXT("X-KRoll-Accept-Encoding");
+const TCHAR* ContentEncodingHeader     = TEXT("X-KRoll-Content-Encoding");
+const TCHAR* UncompressedLengthHeader  = TEXT("X-KRoll-Uncompressed-Length");
+
+struct FKRollEncoding
+{
+	const TCHAR* Token;
+	FName Format;
+};
+
+// In order of preference
+const FKRollEncoding SupportedEncodings[] =
+{
+	{ TEXT("oodle"),   NAME_Oodle },
+	{ TEXT("gzip"),    NAME_Gzip },
+	{ TEXT("deflate"), NAME_Zlib },
+};
+
+FString MakeAcceptEncoding()
+{
+	TArray<FString> Tokens;
+	for (const FKRollEncoding& Encoding : SupportedEncodings)
+	{
+		// Oodle is only offered when the format module is present in this build
+		if (FCompression::IsFormatValid(Encoding.Format))
+		{
+			Tokens.Add(Encoding.Token);
+		}
+	}
+	return FString::Join(Tokens, TEXT(", "));
+}
+
+// False for an encoding we did not offer; NAME_None means uncompressed
+bool ParseContentEncoding(FString Header, FName& OutFormat)
+{
+	Header.TrimStartAndEndInline();
+	OutFormat = NAME_None;
+
+	if (Header.IsEmpty() || Header.Equals(TEXT("identity"), ESearchCase::IgnoreCase))
+	{
+		return true;
+	}
+
+	for (const FKRollEncoding& Encoding : SupportedEncodings)
+	{
+		if (Header.Equals(Encoding.Token, ESearchCase::IgnoreCase))
+		{
+			OutFormat = Encoding.Format;
+			return FCompression::IsFormatValid(OutFormat);
+		}
+	}
+	return false;
+}
+
+bool DecompressPayload(FName Format, TConstArrayView<uint8> Compressed, int64 UncompressedSize, int64 MaxBytes, TArray64<uint8>& OutBytes)
+{
+	// gzip carries the size (mod 2^32) in its trailer; other formats need the header
+	if (UncompressedSize <= 0 && Format == NAME_Gzip && Compressed.Num() >= 4)
+	{
+		const uint8* Trailer = Compressed.GetData() + Compressed.Num() - 4;
+		UncompressedSize = int64(Trailer[0]) | (int64(Trailer[1]) << 8) | (int64(Trailer[2]) << 16) | (int64(Trailer[3]) << 24);
+	}
+
+	if (UncompressedSize <= 0 || UncompressedSize > FMath::Min<int64>(MaxBytes, MAX_int32))
+	{
+		return false;
+	}
+
+	OutBytes.SetNumUninitialized(UncompressedSize);
+	return FCompression::UncompressMemory(Format, OutBytes.GetData(), int32(UncompressedSize), Compressed.GetData(), Compressed.Num());
+}
+
+// Serves a binary snapshot straight out of the HTTP response body
+class FResponseSnapshotStorage final : public IKRollSnapshotStorage
+{
+public:
+	explicit FResponseSnapshotStorage(FHttpResponsePtr InResponse) : Response(MoveTemp(InResponse)) {}
+
+	virtual TConstArrayView64<uint8> GetBytes() const override
+	{
+		const TArray<uint8>& Content = Response->GetContent();
+		return TConstArrayView64<uint8>(Content.GetData(), Content.Num());
+	}
+
+private:
+	FHttpResponsePtr Response;
+};
+
+// Every instance in the process saves to the same file. Saves run one after another in publish
+// order, and a save a newer publish has superseded is skipped, so the file never goes back in time.
+UE::Tasks::FTask GLastSnapshotSave;
+std::atomic<uint32> GNewestSnapshotToSave{0};
+
+void SaveSnapshotInOrder(const FKRollSnapshotPtr& Snapshot)
+{
+	check(IsInGameThread());
+
+	const uint32 Generation = Snapshot->GetGeneration();
+	GNewestSnapshotToSave.store(Generation);
+
+	auto Save = [Snapshot, Generation]()
+	{
+		if (GNewestSnapshotToSave.load() != Generation)
+		{
+			return;
+		}
+		if (!FKRollSnapshotFile::Save(*Snapshot, FKRollSnapshotFile::GetDefaultPath()))
+		{
+			UE_LOG(LogKRoll, Verbose, TEXT("KRoll: snapshot not persisted (no meta hash or write failed)"));
+		}
+	};
+
+	GLastSnapshotSave = GLastSnapshotSave.IsValid()
+		? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Save), UE::Tasks::Prerequisites(GLastSnapshotSave), UE::Tasks::ETaskPriority::BackgroundLow)
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Save), UE::Tasks::ETaskPriority::BackgroundLow);
+}
+}
 
 void UKRollSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	bDeinitialized = false;
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UKRollSubsystem::Tick));
 
 	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	if (Settings && Settings->bPersistSnapshot)
+	{
+		LoadPersistedSnapshot();
+	}
+
+	LoadBindingManifest();
+
+	// Makes FKRollAPI reads (any thread) resolve to this instance
+	const FWorldContext* WorldContext = GetGameInstance()->GetWorldContext();
+	FKRollAPI::Register(this, WorldContext ? WorldContext->PIEInstance : INDEX_NONE);
+
+	RefreshRandom.Initialize(int32(FPlatformTime::Cycles() ^ FPlatformProcess::GetCurrentProcessId()));
+
 	if (Settings && Settings->bAutoFetchOnInit)
 	{
 		FetchConfigs();
 	}
+	else if (Settings && Settings->bAutoRefresh)
+	{
+		// Polling starts with a fetch on the first tick, not a full interval from now
+		NextRefreshAt = FPlatformTime::Seconds();
+	}
 }
 
-void UKRollSubsystem::Deinitialize()
+void UKRollSubsystem::LoadBindingManifest()
 {
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+
+#if WITH_METADATA
+	// Metadata is authoritative where it exists; the manifest may predate the last code change
+	if (!Settings || !Settings->bUseBindingManifestInEditor)
 	{
-		FWriteScopeLock Lock(CacheLock);
-		Cache.Empty();
+		return;
 	}
+#endif
 
+	BindingManifest = Settings ? Cast<UKRollBindingManifest>(Settings->BindingManifest.TryLoad()) : nullptr;
+	if (!BindingManifest)
 	{
-		FWriteScopeLock Lock(MetaLock);
-		bHasSnapshotMeta = false;
-		SnapshotMeta = FKRollSnapshotMeta{};
+		UE_LOG(LogKRoll, Warning, TEXT("KRoll: binding manifest %s not found; property bindings are disabled in this build"),
+			   Settings ? *Settings->BindingManifest.ToString() : TEXT("(none)"));
+		return;
 	}
 
-	bIsReady = false;
+	UE_LOG(LogKRoll, Log, TEXT("KRoll: binding manifest loaded (%d classes)"), BindingManifest->NumClasses());
+}
+
+void UKRollSubsystem::LoadPersistedSnapshot()
+{
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	const bool bAllowTypeCoercion = Settings && Settings->bAllowTypeCoercion;
+
+	const double LoadStart = FPlatformTime::Seconds();
+	const FString Path = FKRollSnapshotFile::GetDefaultPath();
+
+	const FKRollSnapshotPtr Persisted = FKRollSnapshotFile::Load(Path, bAllowTypeCoercion);
+	if (!Persisted.IsValid())
+	{
+		return;
+	}
+
+	PublishPersistedSnapshot(Persisted);
+
+	UE_LOG(LogKRoll, Log, TEXT("KRoll ready from disk: snapshot_id=%s hash=%s values=%d (%.2fms)"),
+		   *Persisted->GetMeta().ActiveSnapshotId,
+		   *Persisted->GetMeta().ActiveSnapshotHash,
+		   Persisted->Num(),
+		   (FPlatformTime::Seconds() - LoadStart) * 1000.0);
+}
+
+void UKRollSubsystem::PublishPersistedSnapshot(const FKRollSnapshotPtr& Persisted)
+{
+	// Ready immediately; the network fetch only upgrades it (or gets a 304 for the same hash)
+	Store->Publish(Persisted);
+	QueueChangedKeys(FKRollSnapshotDiff::Compute(nullptr, *Persisted));
+
+	// Nobody can have bound to OnConfigReady during Initialize, and a fetch that confirms this
+	// snapshot does not publish again, so the first tick announces it
+	bConfigReadyPending = true;
+}
+
+void UKRollSubsystem::Deinitialize()
+{
+	bDeinitialized = true;
+	FKRollAPI::Unregister(this);
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	Store->Reset();
 
 	if (ActiveRequest.IsValid())
 	{
@@ -49,12 +303,13 @@ void UKRollSubsystem::FetchConfigs()
 		return; // misconfigured SDK → safe no-op
 	}
 
-	// Cancel any in-flight request (MVP)
+	// Coalesce: everyone who asked gets the result of the request already in flight
 	if (ActiveRequest.IsValid())
 	{
-		ActiveRequest->CancelRequest();
-		ActiveRequest.Reset();
+		UE_LOG(LogKRoll, Verbose, TEXT("KRoll: fetch already in flight; coalesced"));
+		return;
 	}
+	NextRefreshAt = 0.0;
 
 	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
 
@@ -63,27 +318,45 @@ void UKRollSubsystem::FetchConfigs()
 
 	Request->SetURL(Url);
 	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	if (Settings->RequestTimeoutSeconds > 0.f)
+	{
+		Request->SetTimeout(Settings->RequestTimeoutSeconds);
+	}
+	Request->SetHeader(TEXT("Accept"), Settings->bAcceptBinarySnapshot
+		? FString::Printf(TEXT("%s, application/json;q=0.9"), BinarySnapshotContentType)
+		: FString(TEXT("application/json")));
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 
+	if (Settings->bRequestCompression)
+	{
+		const FString AcceptEncoding = MakeAcceptEncoding();
+		if (!AcceptEncoding.IsEmpty())
+		{
+			Request->SetHeader(AcceptEncodingHeader, AcceptEncoding);
+		}
+	}
+
 	// Auth header
 	Request->SetHeader(TEXT("X-API-Key"), Settings->ApiKey);
 
-	// TODO: body may include app/version/environment; keep "{}" for MVP
-	Request->SetContentAsString(TEXT("{}"));
+	// Conditional fetch: tell the backend what we already have so it can answer 304
+	const FKRollSnapshotPtr Current = Settings->bConditionalFetch ? Store->Pin() : nullptr;
+	const FKRollSnapshotMeta* CurrentMeta =
+		Current.IsValid() && Current->HasMeta() && !Current->GetMeta().ActiveSnapshotHash.IsEmpty() ? &Current->GetMeta() : nullptr;
+	if (CurrentMeta)
+	{
+		Request->SetHeader(TEXT("If-None-Match"), FString::Printf(TEXT("\"%s\""), *CurrentMeta->ActiveSnapshotHash));
+	}
 
-	Request->OnProcessRequestComplete().BindUObject(this, &UKRollSubsystem::OnFetchResponse);
+	// TODO: body may include app/version/environment
+	Request->SetContentAsString(MakeFetchBody(CurrentMeta));
+
+	Request->OnProcessRequestComplete().BindUObject(this, &UKRollSubsystem::OnFetchResponse, ++NextRequestId);
 
 	ActiveRequest = Request;
 	Request->ProcessRequest();
 }
 
-bool UKRollSubsystem::ParseRootObject(const FString& JsonText, TSharedPtr<FJsonObject>& OutRoot)
-{
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
-	return FJsonSerializer::Deserialize(Reader, OutRoot) && OutRoot.IsValid();
-}
-
 FString UKRollSubsystem::JoinPath(const FString& Prefix, const FString& Key)
 {
 	if (Prefix.IsEmpty()) return Key;
@@ -147,244 +420,548 @@ void UKRollSubsystem::FlattenJsonValue(
 	}
 }
 
-bool UKRollSubsystem::ParseSnapshotMeta(const TSharedPtr<FJsonObject>& RootObj, FKRollSnapshotMeta& OutMeta)
+void UKRollSubsystem::KeepCurrentSnapshot(const TCHAR* Reason)
+{
+	UE_LOG(LogKRoll, Verbose, TEXT("KRoll: snapshot %s"), Reason);
+	ScheduleNextRefresh();
+}
+
+bool UKRollSubsystem::Tick(float DeltaTime)
 {
-	if (!RootObj.IsValid())
+	// Free snapshots retired by earlier publishes once no reader can still see them
+	Store->Reclaim();
+
+	if (bConfigReadyPending)
 	{
-		return false;
+		bConfigReadyPending = false;
+		OnConfigReady.Broadcast();
 	}
 
-	const TSharedPtr<FJsonObject>* MetaObjPtr = nullptr;
-	if (!RootObj->TryGetObjectField(TEXT("meta"), MetaObjPtr) || !MetaObjPtr || !MetaObjPtr->IsValid())
+	if (NextRefreshAt > 0.0 && !ActiveRequest.IsValid() && FPlatformTime::Seconds() >= NextRefreshAt)
 	{
-		return false; // meta is optional
+		FetchConfigs();
 	}
 
-	const TSharedPtr<FJsonObject>& MetaObj = *MetaObjPtr;
+	FlushChangedKeys();
+	return true;
+}
 
-	OutMeta = FKRollSnapshotMeta{};
+FDelegateHandle UKRollSubsystem::SubscribeKey(FName Key, FKRollKeysChangedDelegate Delegate)
+{
+	FKeySubscription& Subscription = KeySubscriptions.AddDefaulted_GetRef();
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.Key = Key;
+	Subscription.Delegate = MoveTemp(Delegate);
+	return Subscription.Handle;
+}
+
+FDelegateHandle UKRollSubsystem::SubscribePrefix(const FString& Prefix, FKRollKeysChangedDelegate Delegate)
+{
+	FKeySubscription& Subscription = KeySubscriptions.AddDefaulted_GetRef();
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.Prefix = Prefix;
+	Subscription.bIsPrefix = true;
 
-	OutMeta.SchemaVersion = MetaObj->GetIntegerField(TEXT("schema_version"));
-	OutMeta.ActiveSnapshotId = MetaObj->GetStringField(TEXT("active_snapshot_id"));
-	OutMeta.ActiveSnapshotHash = MetaObj->GetStringField(TEXT("active_snapshot_hash"));
-	OutMeta.Label = MetaObj->GetStringField(TEXT("label"));
+	// "characters.zombie." means the same as "characters.zombie"; Matches() adds the separator itself
+	while (Subscription.Prefix.EndsWith(TEXT(".")))
+	{
+		Subscription.Prefix.LeftChopInline(1);
+	}
+	Subscription.Delegate = MoveTemp(Delegate);
+	return Subscription.Handle;
+}
 
-	// published_at is ISO 8601. If parse fails, keep default (min) and still treat meta as present.
-	const FString PublishedAtStr = MetaObj->GetStringField(TEXT("published_at"));
-	FDateTime::ParseIso8601(*PublishedAtStr, OutMeta.PublishedAt);
+void UKRollSubsystem::Unsubscribe(FDelegateHandle Handle)
+{
+	KeySubscriptions.RemoveAll([Handle](const FKeySubscription& Subscription)
+	{
+		return Subscription.Handle == Handle;
+	});
+}
 
-	return OutMeta.IsValid();
+void UKRollSubsystem::QueueChangedKeys(const FKRollSnapshotDiff& Diff)
+{
+	PendingChangedKeys.Append(Diff.Added);
+	PendingChangedKeys.Append(Diff.Removed);
+	PendingChangedKeys.Append(Diff.Changed);
 }
 
-bool UKRollSubsystem::BuildCacheFromEnvelope(const TSharedPtr<FJsonObject>& RootObj, TMap<FName, TSharedPtr<FJsonValue>>& OutCache)
+bool UKRollSubsystem::FKeySubscription::Matches(FName InKey, const FString& KeyString) const
 {
-	if (!RootObj.IsValid())
+	if (!bIsPrefix)
 	{
-		return false;
+		return Key == InKey;
 	}
 
-	const TSharedPtr<FJsonObject>* ValuesObjPtr = nullptr;
-	if (!RootObj->TryGetObjectField(TEXT("values"), ValuesObjPtr) || !ValuesObjPtr || !ValuesObjPtr->IsValid())
+	// Prefixes match whole path segments: "characters.zombie" covers "characters.zombie.health", not "characters.zombies"
+	return Prefix.IsEmpty()
+		|| (KeyString.StartsWith(Prefix) && (KeyString.Len() == Prefix.Len() || KeyString[Prefix.Len()] == TEXT('.')));
+}
+
+void UKRollSubsystem::FlushChangedKeys()
+{
+	if (PendingChangedKeys.IsEmpty())
 	{
-		return false;
+		return;
 	}
 
-	const TSharedPtr<FJsonObject>& ValuesObj = *ValuesObjPtr;
+	const TSet<FName> ChangedSet = MoveTemp(PendingChangedKeys);
+	const TArray<FName> ChangedKeys = ChangedSet.Array();
+	PendingChangedKeys.Reset();
+
+	// Listeners may (un)subscribe while being notified
+	const TArray<FKeySubscription> Subscriptions = KeySubscriptions;
+
+	TArray<FString> KeyStrings;
+	TArray<FName> Matched;
 
-	for (const TPair<FString, TSharedPtr<FJsonValue>>& It : ValuesObj->Values)
+	for (const FKeySubscription& Subscription : Subscriptions)
 	{
-		if (It.Key.IsEmpty() || !It.Value.IsValid())
+		Matched.Reset();
+
+		if (!Subscription.bIsPrefix)
 		{
-			continue;
+			if (ChangedSet.Contains(Subscription.Key))
+			{
+				Matched.Add(Subscription.Key);
+			}
 		}
+		else if (Subscription.Prefix.IsEmpty())
+		{
+			// Matches everything; no key strings needed
+			Matched = ChangedKeys;
+		}
+		else
+		{
+			if (KeyStrings.IsEmpty())
+			{
+				KeyStrings.Reserve(ChangedKeys.Num());
+				for (const FName Key : ChangedKeys)
+				{
+					KeyStrings.Add(Key.ToString());
+				}
+			}
 
-		OutCache.Add(FName(*It.Key), It.Value);
+			for (int32 Idx = 0; Idx < ChangedKeys.Num(); ++Idx)
+			{
+				if (Subscription.Matches(ChangedKeys[Idx], KeyStrings[Idx]))
+				{
+					Matched.Add(ChangedKeys[Idx]);
+				}
+			}
+		}
+
+		if (!Matched.IsEmpty())
+		{
+			Subscription.Delegate.ExecuteIfBound(Matched);
+		}
 	}
 
-	return true;
+	OnKeysChanged.Broadcast(ChangedKeys);
 }
 
-FKRollSnapshotMeta UKRollSubsystem::GetSnapshotMeta() const
+void UKRollSubsystem::ScheduleNextRefresh()
 {
-	FReadScopeLock Lock(MetaLock);
-	return SnapshotMeta;
+	ConsecutiveFailures = 0;
+
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	if (!Settings || !Settings->bAutoRefresh)
+	{
+		NextRefreshAt = 0.0;
+		return;
+	}
+
+	// Jitter spreads a fleet that started together so it does not poll in lockstep
+	const float Jitter = FMath::Clamp(Settings->RefreshJitter, 0.f, 1.f);
+	const double Delay = Settings->RefreshIntervalSeconds * RefreshRandom.FRandRange(1.f - Jitter, 1.f + Jitter);
+	NextRefreshAt = FPlatformTime::Seconds() + FMath::Max(Delay, 1.0);
 }
 
-void UKRollSubsystem::OnFetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+void UKRollSubsystem::ScheduleRetry(const FHttpResponsePtr& Response)
 {
-	ActiveRequest.Reset();
+	++ConsecutiveFailures;
 
-	if (!bSuccess || !Response.IsValid())
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	if (!Settings || !Settings->bAutoRefresh)
 	{
-		return; // keep previous cache
+		NextRefreshAt = 0.0;
+		return;
 	}
 
-	const int32 Code = Response->GetResponseCode();
-	if (Code < 200 || Code >= 300)
-	{
-		return; // keep previous cache
-	}
+	// Exponential backoff with "equal jitter": half fixed, half random
+	const double Backoff = FMath::Min<double>(
+		Settings->RetryMaxDelaySeconds,
+		Settings->RetryInitialDelaySeconds * FMath::Pow(2.0, FMath::Min(ConsecutiveFailures - 1, 16)));
+	double Delay = Backoff * RefreshRandom.FRandRange(0.5f, 1.f);
 
-	TSharedPtr<FJsonObject> RootObj;
-	if (!ParseRootObject(Response->GetContentAsString(), RootObj))
+	// An overloaded backend knows better than our schedule
+	int32 RetryAfter = 0;
+	if (Response.IsValid() && LexTryParseString(RetryAfter, *Response->GetHeader(TEXT("Retry-After"))))
 	{
-		return; // keep previous cache
+		Delay = FMath::Max<double>(Delay, RetryAfter);
 	}
 
-	// Build new cache from envelope
-	TMap<FName, TSharedPtr<FJsonValue>> NewCache;
-	if (!BuildCacheFromEnvelope(RootObj, NewCache))
-	{
-		return; // keep previous cache
-	}
+	NextRefreshAt = FPlatformTime::Seconds() + FMath::Max(Delay, 0.1);
 
-	// Parse meta (optional)
-	FKRollSnapshotMeta NewMeta;
-	const bool bParsedMeta = ParseSnapshotMeta(RootObj, NewMeta);
+	UE_LOG(LogKRoll, Verbose, TEXT("KRoll: fetch failed (%d in a row); retrying in %.1fs"), ConsecutiveFailures, Delay);
+}
 
+bool UKRollSubsystem::HasSnapshotMeta() const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->HasMeta();
+}
+
+FKRollSnapshotMeta UKRollSubsystem::GetSnapshotMeta() const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->HasMeta() ? Snapshot->GetMeta() : FKRollSnapshotMeta{};
+}
+
+uint32 UKRollSubsystem::GetSnapshotGeneration() const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot ? Snapshot->GetGeneration() : 0;
+}
+
+void UKRollSubsystem::OnFetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, uint32 RequestId)
+{
+	if (Request == ActiveRequest)
 	{
-		FWriteScopeLock Lock(CacheLock);
-		Cache = MoveTemp(NewCache);
+		ActiveRequest.Reset();
 	}
 
+	// Cancelled by Deinitialize, or completed after it
+	if (bDeinitialized)
 	{
-		FWriteScopeLock Lock(MetaLock);
-		bHasSnapshotMeta = bParsedMeta;
-		SnapshotMeta = bParsedMeta ? NewMeta : FKRollSnapshotMeta{};
+		return;
 	}
 
-	bIsReady = true;
+	if (!bSuccess || !Response.IsValid())
+	{
+		ScheduleRetry(Response);
+		return; // keep previous cache
+	}
 
-	// Log once when we become ready (useful for ops/telemetry)
-	if (bHasSnapshotMeta)
+	const int32 Code = Response->GetResponseCode();
+	if (Code == EHttpResponseCodes::NotModified)
 	{
-		UE_LOG(LogKRoll, Log, TEXT("KRoll ready: snapshot_id=%s hash=%s published_at=%s label=%s"),
-			   *SnapshotMeta.ActiveSnapshotId,
-			   *SnapshotMeta.ActiveSnapshotHash,
-			   *SnapshotMeta.PublishedAt.ToIso8601(),
-			   *SnapshotMeta.Label
-			   );
+		KeepCurrentSnapshot(TEXT("not modified"));
+		return; // nothing to parse, swap or broadcast
 	}
-	else
+	if (Code < 200 || Code >= 300)
 	{
-		UE_LOG(LogKRoll, Log, TEXT("KRoll ready: snapshot meta missing (values loaded)"));
+		ScheduleRetry(Response);
+		return; // keep previous cache
 	}
 
-	OnConfigReady.Broadcast();
-}
-
-TSharedPtr<FJsonValue> UKRollSubsystem::GetJson(FName Key) const
-{
-	FReadScopeLock Lock(CacheLock);
-	const TSharedPtr<FJsonValue>* Found = Cache.Find(Key);
-	return Found ? *Found : nullptr;
-}
+	// A 2xx is only a success once the body has been turned into a snapshot; the schedule is set
+	// from that outcome, so a backend serving garbage is retried with backoff, not polled at full rate
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
 
-bool UKRollSubsystem::GetBool(FName Key, bool& OutValue) const
-{
-	TSharedPtr<FJsonValue> V = GetJson(Key);
-	if (!V.IsValid())
+	// Backends that ignore If-None-Match may still tag the payload; skip the parse if it is what we have
+	if (Settings && Settings->bConditionalFetch && IsCurrentSnapshotHash(NormalizeETag(Response->GetHeader(TEXT("ETag")))))
 	{
-		return false;
+		KeepCurrentSnapshot(TEXT("unchanged (ETag match)"));
+		return;
 	}
 
-	if (V->Type == EJson::Boolean)
+	// Coercion policy is baked into the slots when they are built,
+	// so a settings change applies from the next published snapshot.
+	const bool bAllowTypeCoercion = Settings && Settings->bAllowTypeCoercion;
+	const UE::Tasks::ETaskPriority Priority = ToTaskPriority(
+		Settings ? Settings->SnapshotBuildPriority : EKRollSnapshotBuildPriority::BackgroundNormal);
+	const int64 MaxSnapshotBytes = Settings ? int64(Settings->MaxSnapshotMegabytes) * 1024 * 1024 : MAX_int32;
+
+	FName Encoding;
+	const FString EncodingHeader = Response->GetHeader(ContentEncodingHeader);
+	if (!ParseContentEncoding(EncodingHeader, Encoding))
 	{
-		OutValue = V->AsBool();
-		return true;
+		UE_LOG(LogKRoll, Warning, TEXT("KRoll: unsupported snapshot encoding '%s'; keeping previous snapshot"), *EncodingHeader);
+		ScheduleRetry(Response);
+		return;
 	}
 
-	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
-	if (Settings && Settings->bAllowTypeCoercion)
+	int64 UncompressedSize = 0;
+	LexFromString(UncompressedSize, *Response->GetHeader(UncompressedLengthHeader));
+
+	// The worker diffs against what is current now; PublishSnapshot re-diffs if that changes meanwhile
+	const FKRollSnapshotPtr Previous = Store->Pin();
+
+	// Decompress + parse + build on a worker; only the publish and broadcast come back to the game thread.
+	// The response is held by the task, so its body stays alive without a copy.
+	const TWeakObjectPtr<UKRollSubsystem> WeakThis(this);
+	const double QueuedAt = FPlatformTime::Seconds();
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis, Response, Previous, RequestId, bAllowTypeCoercion, QueuedAt, Encoding, UncompressedSize, MaxSnapshotBytes]()
 	{
-		if (V->Type == EJson::Number)
+		// Every "keeping previous snapshot" path below backs off like a failed request
+		const auto RetryLater = [WeakThis, Response]()
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Response]()
+			{
+				UKRollSubsystem* This = WeakThis.Get();
+				if (This && !This->bDeinitialized)
+				{
+					This->ScheduleRetry(Response);
+				}
+			});
+		};
+
+		FKRollFetchStats Stats;
+		double ParseStart = FPlatformTime::Seconds();
+		Stats.QueueMs = ToMs(ParseStart - QueuedAt);
+
+		const TArray<uint8>& Received = Response->GetContent();
+		Stats.PayloadBytes = Received.Num();
+		Stats.UncompressedBytes = Received.Num();
+
+		TArray64<uint8> Decompressed;
+		TConstArrayView<uint8> Body = Received;
+
+		if (!Encoding.IsNone())
 		{
-			OutValue = (V->AsNumber() != 0.0);
-			return true;
+			if (!DecompressPayload(Encoding, Received, UncompressedSize, MaxSnapshotBytes, Decompressed))
+			{
+				UE_LOG(LogKRoll, Warning, TEXT("KRoll: failed to decompress %s snapshot (%d bytes); keeping previous snapshot"),
+					   *Encoding.ToString(), Received.Num());
+				RetryLater();
+				return; // keep previous cache
+			}
+
+			Body = TConstArrayView<uint8>(Decompressed.GetData(), int32(Decompressed.Num()));
+			Stats.UncompressedBytes = Decompressed.Num();
+
+			const double DecompressedAt = FPlatformTime::Seconds();
+			Stats.DecompressMs = ToMs(DecompressedAt - ParseStart);
+			ParseStart = DecompressedAt;
 		}
-		if (V->Type == EJson::String)
+
+		// Binary payloads skip the parse; validating them counts as build time
+		FKRollSnapshotPtr NewSnapshot;
+		double BuildStart = ParseStart;
+
+		if (Response->GetContentType().StartsWith(BinarySnapshotContentType))
 		{
-			const FString S = V->AsString().ToLower();
-			if (S == TEXT("true") || S == TEXT("1") || S == TEXT("yes") || S == TEXT("y"))
+			// Already in snapshot form: validate and read it in place, nothing to parse
+			FString Error;
+			NewSnapshot = Encoding.IsNone()
+				? FKRollSnapshot::FromStorage(MakeUnique<FResponseSnapshotStorage>(Response), &Error)
+				: FKRollSnapshot::FromBytes(MoveTemp(Decompressed), &Error);
+			if (!NewSnapshot.IsValid())
 			{
-				OutValue = true; return true;
+				UE_LOG(LogKRoll, Warning, TEXT("KRoll: binary snapshot rejected (%s, %d bytes); keeping previous snapshot"),
+					   *Error, Body.Num());
+				RetryLater();
+				return; // keep previous cache
 			}
-			if (S == TEXT("false") || S == TEXT("0") || S == TEXT("no") || S == TEXT("n"))
+			if (NewSnapshot->WasBuiltWithTypeCoercion() != bAllowTypeCoercion)
 			{
-				OutValue = false; return true;
+				UE_LOG(LogKRoll, Verbose, TEXT("KRoll: binary snapshot was built with a different coercion policy; using it as served"));
 			}
 		}
-	}
+		else
+		{
+			FKRollSnapshotParser::FResult Parsed;
+			if (!FKRollSnapshotParser::Parse(Body, bAllowTypeCoercion, Parsed))
+			{
+				UE_LOG(LogKRoll, Warning, TEXT("KRoll: fetch response is not a valid snapshot envelope (%d bytes); keeping previous snapshot"),
+					   Body.Num());
+				RetryLater();
+				return; // keep previous cache
+			}
 
-	return false;
+			BuildStart = FPlatformTime::Seconds();
+			Stats.ParseMs = ToMs(BuildStart - ParseStart);
+
+			// Values and meta are published together; readers never see a mix of two fetches
+			FString Error;
+			NewSnapshot = FKRollSnapshot::Build(
+				MoveTemp(Parsed.Values),
+				Parsed.bHasMeta ? &Parsed.Meta : nullptr,
+				bAllowTypeCoercion,
+				&Error
+			);
+			if (!NewSnapshot.IsValid())
+			{
+				UE_LOG(LogKRoll, Warning, TEXT("KRoll: could not build snapshot (%s, %d bytes); keeping previous snapshot"),
+					   *Error, Body.Num());
+				RetryLater();
+				return; // keep previous cache
+			}
+		}
+		Stats.NumValues = NewSnapshot->Num();
+		Stats.SnapshotBytes = NewSnapshot->GetBlob().Num();
+
+		const double DiffStart = FPlatformTime::Seconds();
+		Stats.BuildMs = ToMs(DiffStart - BuildStart);
+
+		FKRollSnapshotDiff Diff = FKRollSnapshotDiff::Compute(Previous.Get(), *NewSnapshot);
+
+		const double BuiltAt = FPlatformTime::Seconds();
+		Stats.DiffMs = ToMs(BuiltAt - DiffStart);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, NewSnapshot, Diff = MoveTemp(Diff), Stats, RequestId, BuiltAt]() mutable
+		{
+			UKRollSubsystem* This = WeakThis.Get();
+			if (This && !This->bDeinitialized)
+			{
+				This->ScheduleNextRefresh();
+				This->PublishSnapshot(NewSnapshot, MoveTemp(Diff), Stats, RequestId, BuiltAt);
+			}
+		});
+	}, Priority);
 }
 
-bool UKRollSubsystem::GetNumber(FName Key, double& OutValue) const
+bool UKRollSubsystem::IsCurrentSnapshotHash(const FString& Hash) const
 {
-	TSharedPtr<FJsonValue> V = GetJson(Key);
-	if (!V.IsValid())
+	if (Hash.IsEmpty())
 	{
 		return false;
 	}
 
-	if (V->Type == EJson::Number)
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->HasMeta() && Snapshot->GetMeta().ActiveSnapshotHash == Hash;
+}
+
+void UKRollSubsystem::PublishSnapshot(const FKRollSnapshotPtr& NewSnapshot, FKRollSnapshotDiff&& Diff, FKRollFetchStats Stats, uint32 RequestId, double BuiltAt)
+{
+	check(IsInGameThread());
+
+	if (bDeinitialized)
 	{
-		OutValue = V->AsNumber();
-		return true;
+		return;
 	}
 
-	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
-	if (Settings && Settings->bAllowTypeCoercion)
+	if (RequestId < LastPublishedRequestId)
 	{
-		if (V->Type == EJson::Boolean)
-		{
-			OutValue = V->AsBool() ? 1.0 : 0.0;
-			return true;
-		}
-		if (V->Type == EJson::String)
-		{
-			const FString& S = V->AsString();
-			double Parsed = 0.0;
+		return; // a newer fetch already landed
+	}
+	LastPublishedRequestId = RequestId;
 
-			if (LexTryParseString(Parsed, *S))
-			{
-				OutValue = Parsed;
-				return true;
-			}
-		}
+	// Same snapshot as the one already published: no swap, no re-broadcast
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	const bool bConditionalFetch = Settings && Settings->bConditionalFetch;
+	if (bConditionalFetch && NewSnapshot->HasMeta() && IsCurrentSnapshotHash(NewSnapshot->GetMeta().ActiveSnapshotHash))
+	{
+		UE_LOG(LogKRoll, Verbose, TEXT("KRoll: snapshot unchanged (hash match)"));
+		return;
 	}
 
-	return false;
-}
+	const double PublishStart = FPlatformTime::Seconds();
+	Stats.DispatchMs = ToMs(PublishStart - BuiltAt);
 
-bool UKRollSubsystem::GetString(FName Key, FString& OutValue) const
-{
-	TSharedPtr<FJsonValue> V = GetJson(Key);
-	if (!V.IsValid())
+	// Another snapshot was published while this one was being built; the worker's diff is stale
 	{
-		return false;
+		FKRollSnapshotStore::FReadScope Current(*Store);
+		const uint32 CurrentGeneration = Current ? Current->GetGeneration() : 0;
+		if (Diff.FromGeneration != CurrentGeneration)
+		{
+			Diff = FKRollSnapshotDiff::Compute(Current.Get(), *NewSnapshot);
+		}
 	}
 
-	if (V->Type == EJson::String)
+	Store->Publish(NewSnapshot);
+	Stats.NumChangedKeys = Diff.Num();
+	QueueChangedKeys(Diff);
+
+	const double BroadcastStart = FPlatformTime::Seconds();
+	Stats.PublishMs = ToMs(BroadcastStart - PublishStart);
+
+	// Log once when we become ready (useful for ops/telemetry)
+	if (NewSnapshot->HasMeta())
+	{
+		const FKRollSnapshotMeta& Meta = NewSnapshot->GetMeta();
+		UE_LOG(LogKRoll, Log, TEXT("KRoll ready: snapshot_id=%s hash=%s published_at=%s label=%s generation=%u"),
+			   *Meta.ActiveSnapshotId,
+			   *Meta.ActiveSnapshotHash,
+			   *Meta.PublishedAt.ToIso8601(),
+			   *Meta.Label,
+			   NewSnapshot->GetGeneration()
+			   );
+	}
+	else
 	{
-		OutValue = V->AsString();
-		return true;
+		UE_LOG(LogKRoll, Log, TEXT("KRoll ready: snapshot meta missing (values loaded) generation=%u"),
+			   NewSnapshot->GetGeneration());
 	}
 
-	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
-	if (Settings && Settings->bAllowTypeCoercion)
+	bConfigReadyPending = false;
+	OnConfigReady.Broadcast();
+
+	Stats.BroadcastMs = ToMs(FPlatformTime::Seconds() - BroadcastStart);
+	LastFetchStats = Stats;
+
+	// Snapshots are immutable, so the worker can serialize it while readers keep using it
+	if (Settings && Settings->bPersistSnapshot)
 	{
-		if (V->Type == EJson::Number)
-		{
-			OutValue = FString::SanitizeFloat(V->AsNumber());
-			return true;
-		}
-		if (V->Type == EJson::Boolean)
-		{
-			OutValue = V->AsBool() ? TEXT("true") : TEXT("false");
-			return true;
-		}
+		SaveSnapshotInOrder(NewSnapshot);
 	}
 
-	return false;
+	UE_LOG(LogKRoll, Verbose,
+		   TEXT("KRoll fetch stats: bytes=%lld uncompressed=%lld snapshot=%lld values=%d changed=%d queue=%.2fms decompress=%.2fms parse=%.2fms build=%.2fms diff=%.2fms dispatch=%.2fms publish=%.3fms broadcast=%.2fms"),
+		   Stats.PayloadBytes, Stats.UncompressedBytes, Stats.SnapshotBytes, Stats.NumValues, Stats.NumChangedKeys,
+		   Stats.QueueMs, Stats.DecompressMs, Stats.ParseMs, Stats.BuildMs, Stats.DiffMs,
+		   Stats.DispatchMs, Stats.PublishMs, Stats.BroadcastMs);
+}
+
+TSharedPtr<FJsonValue> UKRollSubsystem::GetJson(FName Key) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot ? Snapshot->GetJson(Snapshot->FindIndex(Key)) : nullptr;
+}
+
+TSharedPtr<FJsonValue> UKRollSubsystem::GetJson(const FKRollKeyHandle& Key) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot ? Snapshot->GetJson(Key.Resolve(*Snapshot)) : nullptr;
+}
+
+bool UKRollSubsystem::GetBool(FName Key, bool& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetBool(Snapshot->FindIndex(Key), OutValue);
+}
+
+bool UKRollSubsystem::GetBool(const FKRollKeyHandle& Key, bool& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetBool(Key.Resolve(*Snapshot), OutValue);
+}
+
+bool UKRollSubsystem::GetNumber(FName Key, double& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetNumber(Snapshot->FindIndex(Key), OutValue);
+}
+
+bool UKRollSubsystem::GetNumber(const FKRollKeyHandle& Key, double& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetNumber(Key.Resolve(*Snapshot), OutValue);
+}
+
+bool UKRollSubsystem::GetInteger(FName Key, int64& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetInteger(Snapshot->FindIndex(Key), OutValue);
+}
+
+bool UKRollSubsystem::GetInteger(const FKRollKeyHandle& Key, int64& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetInteger(Key.Resolve(*Snapshot), OutValue);
+}
+
+bool UKRollSubsystem::GetString(FName Key, FString& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetString(Snapshot->FindIndex(Key), OutValue);
+}
+
+bool UKRollSubsystem::GetString(const FKRollKeyHandle& Key, FString& OutValue) const
+{
+	FKRollSnapshotStore::FReadScope Snapshot(*Store);
+	return Snapshot && Snapshot->TryGetString(Key.Resolve(*Snapshot), OutValue);
 }
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// UTF-8 -> engine string conversions shared by the envelope parser and the binary snapshot reader
+namespace KRollUtf8
+{
+inline FString ToFString(FUtf8StringView Text)
+{
+	const auto Converted = StringCast<TCHAR>(Text.GetData(), Text.Len());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+inline FName MakeName(FUtf8StringView Key)
+{
+	// Config keys are almost always ASCII; skip the conversion for those
+	bool bIsAscii = true;
+	for (const UTF8CHAR C : Key)
+	{
+		if (static_cast<uint8>(C) >= 0x80)
+		{
+			bIsAscii = false;
+			break;
+		}
+	}
+
+	if (bIsAscii)
+	{
+		return FName(Key.Len(), reinterpret_cast<const ANSICHAR*>(Key.GetData()));
+	}
+
+	const auto Converted = StringCast<TCHAR>(Key.GetData(), Key.Len());
+	return FName(Converted.Length(), Converted.Get());
+}
+}
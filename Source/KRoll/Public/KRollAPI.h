@@ -1,18 +1,83 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "KRollKeyHandle.h"
+#include "KRollSnapshotStore.h"
 
 class UKRollSubsystem;
 
+/**
+	* Static access to the config of the current game instance, for code without a world at hand.
+	*
+	* Every UKRollSubsystem registers its (shared) snapshot store here. A read finds the store with a
+	* single atomic load, then reads the snapshot lock-free, so it is safe on any thread; registered
+	* stores outlive their game instance until the module unloads, so one never goes away under a
+	* reader. Which instance is used:
+	*  1. the one bound to the calling thread by an FScopedInstance,
+	*  2. in PIE, on the game thread: the instance of the PIE world currently being ticked,
+	*  3. otherwise the first game instance registered.
+	*
+	* A dedicated server hosting several game instances is not told apart by (3): every unscoped read
+	* serves the first instance's config. Such servers must bind each instance's work with FScopedInstance.
+	*/
 class KROLL_API FKRollAPI
 {
 public:
+	// Binds the calling thread to one game instance's config (e.g. a task working for one PIE client
+	// or for one of several game instances hosted by a server). Worker threads should use the store
+	// overload with a store taken from UKRollSubsystem::GetSharedSnapshotStore() on the game thread.
+	class KROLL_API FScopedInstance
+	{
+	public:
+		explicit FScopedInstance(UKRollSubsystem* Instance);
+		explicit FScopedInstance(const FKRollSnapshotStoreRef& InStore);
+		~FScopedInstance();
+
+		FScopedInstance(const FScopedInstance&) = delete;
+		FScopedInstance& operator=(const FScopedInstance&) = delete;
+
+	private:
+		FKRollSnapshotStorePtr Store;
+		const FKRollSnapshotStore* PreviousStore = nullptr;
+		UKRollSubsystem* PreviousInstance = nullptr;
+	};
+
     static void FetchConfigs();
+	// String keys are hashed as UTF-8 and looked up in the snapshot directly; no FName is created
 	static bool GetBool(const FString& Key, bool DefaultValue);
 	static FString GetString(const FString& Key, const FString& DefaultValue);
 	static double GetNumber(const FString& Key, double DefaultValue);
 	static TSharedPtr<FJsonValue> GetJson(const FString& Key);
 
+	// Literals bind here rather than being ambiguous between FString and FName
+	static bool GetBool(const TCHAR* Key, bool DefaultValue);
+	static FString GetString(const TCHAR* Key, const FString& DefaultValue);
+	static double GetNumber(const TCHAR* Key, double DefaultValue);
+	static TSharedPtr<FJsonValue> GetJson(const TCHAR* Key);
+
+	static bool GetBool(const ANSICHAR* Key, bool DefaultValue);
+	static FString GetString(const ANSICHAR* Key, const FString& DefaultValue);
+	static double GetNumber(const ANSICHAR* Key, double DefaultValue);
+	static TSharedPtr<FJsonValue> GetJson(const ANSICHAR* Key);
+
+	static bool GetBool(FName Key, bool DefaultValue);
+	static FString GetString(FName Key, const FString& DefaultValue);
+	static double GetNumber(FName Key, double DefaultValue);
+	static TSharedPtr<FJsonValue> GetJson(FName Key);
+
+	// Resolve a key once and keep the handle around for per-frame reads (see also KROLL_KEY)
+	static bool GetBool(const FKRollKeyHandle& Key, bool DefaultValue);
+	static FString GetString(const FKRollKeyHandle& Key, const FString& DefaultValue);
+	static double GetNumber(const FKRollKeyHandle& Key, double DefaultValue);
+	static TSharedPtr<FJsonValue> GetJson(const FKRollKeyHandle& Key);
+
+	// Instance FetchConfigs() uses; may be null. Game thread only.
+	static UKRollSubsystem* Resolve();
+
 private:
-    static UKRollSubsystem* Resolve();
+	friend class UKRollSubsystem;
+
+	// Game thread; PIEInstance is INDEX_NONE outside PIE
+	static void Register(UKRollSubsystem* Instance, int32 PIEInstance);
+	static void Unregister(UKRollSubsystem* Instance);
 };
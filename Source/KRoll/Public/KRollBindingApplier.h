@@ -3,9 +3,11 @@
 #include "CoreMinimal.h"
 #include "KRollBindingTypes.h"
 
+class FKRollSnapshot;
 class UKRollSubsystem;
 class UAbilitySystemComponent;
 class UAttributeSet;
+class UGameplayEffect;
 
 class KROLL_API FKRollBindingApplier
 {
@@ -17,21 +19,71 @@ public:
 		const AActor* KeyContextActor
 	);
 
-	static void ApplyAttributeSetBindings(
+	// True if any attribute was written. Seeding several sets of one ASC? Pass bNudgeReplication = false
+	// and call NudgeReplication() once after the last set.
+	static bool ApplyAttributeSetBindings(
 		UAttributeSet* AttributeSet,
 		UAbilitySystemComponent* ASC,
 		const TArray<FKRollPropertyBinding>& Bindings,
 		const UKRollSubsystem* KRollSubsystem,
-		const AActor* KeyContextActor
+		const AActor* KeyContextActor,
+		bool bNudgeReplication = true
+	);
+
+	// Offset and store function for a property of the given kind; invalid if the property does not match
+	static FKRollPropertyWriter CompileWriter(const FProperty* Property, EKRollValueKind Kind);
+
+	// Parses Binding.Transform.DefaultText for Binding.Kind (numbers, bools, enumerator names, ...).
+	// False if it does not fit; the binding is then left without a default.
+	static bool CompileDefault(FKRollPropertyBinding& Binding);
+
+	// Resolves keys and reads values once for every target sharing KeyContext's class and archetype
+	static void BuildPlan(
+		const TArray<FKRollPropertyBinding>& Bindings,
+		const UObject* Target,
+		const UObject* KeyContext,
+		const UKRollSubsystem* KRollSubsystem,
+		FKRollBindingPlan& OutPlan
 	);
 
+	static void ApplyPlan(UObject* Target, const FKRollBindingPlan& Plan);
+
+	// True if any attribute was written (the caller nudges replication)
+	static bool ApplyAttributePlan(UAttributeSet* AttributeSet, const FKRollBindingPlan& Plan);
+
+	// Instant effect overriding every attribute of the plan; null if it has none. Game thread only.
+	static UGameplayEffect* BuildSeedEffect(const FKRollBindingPlan& Plan);
+
+	// EKRollAttributeSeedMode::GameplayEffect counterpart of ApplyAttributePlan
+	static bool ApplySeedEffect(UAbilitySystemComponent* ASC, const UGameplayEffect* SeedEffect);
+
+	// Single-binding writes with an already resolved key (live updates). True if the property was written.
+	static bool ApplyResolvedBinding(UObject* Target, const FKRollPropertyBinding& Binding, FName ResolvedKey, const UKRollSubsystem* KRollSubsystem);
+	static bool SeedAttribute(UAttributeSet* AttributeSet, const FKRollPropertyBinding& Binding, FName ResolvedKey, const UKRollSubsystem* KRollSubsystem);
+
+	// Instant effect overriding just the attributes in Seeds (live updates); null if none of them has a
+	// value. Game thread only.
+	static UGameplayEffect* BuildSeedEffect(TConstArrayView<FKRollPlanEntry> Seeds, const UKRollSubsystem* KRollSubsystem);
+
+	// Gets seeded attribute values out to clients sooner
+	static void NudgeReplication(UAbilitySystemComponent* ASC);
+
 private:
-	static bool ReadBool(const UKRollSubsystem* KRoll, FName Key, bool& Out);
-	static bool ReadNumber(const UKRollSubsystem* KRoll, FName Key, double& Out);
+	// NAME_None if the template cannot be resolved for this target
+	static FName ResolveBindingKey(const FKRollPropertyBinding& Binding, const UObject* KeyContext, const UObject* Target);
 
-	static double ApplyTransform(double V, const FKRollTransform& T);
+	// Static-key bindings resolve through their cached handle; templated ones by ResolvedKey
+	static int32 FindSlot(const FKRollSnapshot& Snapshot, const FKRollPropertyBinding& Binding, FName ResolvedKey);
+
+	// Reads, defaults and transforms the binding's value into a ready-to-apply write; false if there is
+	// nothing to write. Values that do not fit the write record are appended to OutValues.
+	static bool ResolveWrite(
+		const FKRollSnapshot& Snapshot,
+		const FKRollPropertyBinding& Binding,
+		FName ResolvedKey,
+		FKRollPlanWrite& Out,
+		TArray<FKRollPlanValue>& OutValues
+	);
 
-	static void WriteBool(FProperty* Prop, void* Container, bool V);
-	static void WriteInt32(FProperty* Prop, void* Container, int32 V);
-	static void WriteFloat(FProperty* Prop, void* Container, float V);
+	static bool ResolveEnum(const FKRollSnapshot& Snapshot, int32 Slot, const FKRollPropertyBinding& Binding, FKRollPlanWrite& Out);
 };
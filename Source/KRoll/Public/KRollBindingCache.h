@@ -2,45 +2,230 @@
 
 #include "CoreMinimal.h"
 #include "KRollBindingTypes.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UKRollSubsystem;
+class UKRollBindingManifest;
+class UGameplayEffect;
+struct FKRollManifestBinding;
+struct FKRollManifestClass;
 
 /**
-	* Per-class bindings (MVP):
-	*  - Actor bindings: bool/int32/float properties on the actor class
+	* Per-class bindings:
+	*  - Actor bindings: properties on the actor class (see EKRollValueKind); a KRollKey on a struct
+	*    property binds its members as "<key>.<member KRollKey or name>", nesting up to MaxStructDepth levels
 	*  - Component bindings: discovered from actor CDO's components, keyed by component class
 	*  - AttributeSet bindings: built per AttributeSet class on demand
 	*/
 struct FKRollClassBindings
 {
 	TArray<FKRollPropertyBinding> ActorBindings;
+
+	// Only component classes that have bindings
 	TMap<UClass*, TArray<FKRollPropertyBinding>> ComponentBindings;
+
+	// Negative cache: spawns of classes with none of these skip the instance entirely
+	bool bHasActorBindings = false;
+	bool bHasComponentBindings = false;
+
+	// Pawns, controllers, player states and IAbilitySystemInterface actors can lead to an ASC
+	bool bIsAbilitySystemContext = false;
+
+	// Learned at runtime: an instance reached an ASC whose attribute sets bind nothing, so later
+	// instances skip the ASC walk. See FKRollBindingCache::SetNoAttributeBindings.
+	bool bNoAttributeBindings = false;
 };
 
 class KROLL_API FKRollBindingCache
 {
 public:
+	FKRollBindingCache() = default;
+
+	// Reads bindings from Manifest instead of property metadata (required in builds without metadata)
+	explicit FKRollBindingCache(const UKRollBindingManifest* InManifest);
+
+#if WITH_METADATA
+	// Bindings declared by Class's property metadata, in manifest form (cook time)
+	static void DescribeClassBindings(UClass* Class, TArray<FKRollManifestBinding>& Out);
+#endif
+
+	// The returned references stay valid for the lifetime of the cache
 	const FKRollClassBindings& GetOrBuildActorBindings(UClass* ActorClass);
 	const TArray<FKRollPropertyBinding>& GetOrBuildAttributeSetBindings(UClass* AttributeSetClass);
 
+	// Records whether instances of ActorClass reach attribute sets with bindings. Attribute sets are
+	// assumed to be the same for every instance of a class; ApplyManual clears the flag for classes
+	// that grant sets per instance. Game thread only.
+	void SetNoAttributeBindings(UClass* ActorClass, bool bNoAttributeBindings);
+
+	// Bindings compiled for KeyContext's class and archetype (plus Target's name / the level when the
+	// templates use {component} / {level}); rebuilt when the snapshot generation changes.
+	// Bindings must be the list this cache built for Target's class.
+	// Safe to call from worker threads as long as no snapshot is published meanwhile (publishing is
+	// game-thread only); the binding lists themselves must come from the game thread.
+	const FKRollBindingPlan& GetOrBuildPlan(
+		const TArray<FKRollPropertyBinding>& Bindings,
+		const UObject* Target,
+		const UObject* KeyContext,
+		const UKRollSubsystem* KRollSubsystem
+	);
+
+	// Instant Override effect for an attribute set plan (EKRollAttributeSeedMode::GameplayEffect), built
+	// once per plan and snapshot generation; null if the plan seeds nothing. Game thread only.
+	const UGameplayEffect* GetOrBuildSeedEffect(const FKRollBindingPlan& Plan);
+
+	// Instant Override effect for just the attributes a live update changed on one ASC, shared by every
+	// ASC whose changed attributes are the same (in any order); built once per snapshot generation,
+	// null if none of them has a value. Game thread only.
+	const UGameplayEffect* GetOrBuildUpdateSeedEffect(TConstArrayView<FKRollPlanEntry> Seeds, const UKRollSubsystem* KRollSubsystem);
+
+	// Drops bindings, plans and seed effects of classes that no longer exist (garbage collected,
+	// replaced by a reload). Game thread, outside of any resolve pass.
+	void PruneStaleClasses();
+
 private:
-	// Cache (weak keys avoid holding classes alive on hot reload)
-	TMap<TWeakObjectPtr<UClass>, FKRollClassBindings> ActorCache;
-	TMap<TWeakObjectPtr<UClass>, TArray<FKRollPropertyBinding>> AttributeSetCache;
+	enum class EListKind : uint8
+	{
+		Actor,
+		Component,
+		AttributeSet
+	};
+
+	// Which binding list (kind + the class it was built for) and everything a key template can depend on
+	struct FPlanKey
+	{
+		EListKind Kind = EListKind::Actor;
+		FObjectKey ListClass;
+		FObjectKey ContextClass;
+		FObjectKey OwnerClass;
+		FName Archetype;
+		FName Component;
+		FObjectKey Level;
+
+		bool operator==(const FPlanKey& Other) const
+		{
+			return Kind == Other.Kind && ListClass == Other.ListClass && ContextClass == Other.ContextClass
+				&& OwnerClass == Other.OwnerClass && Archetype == Other.Archetype
+				&& Component == Other.Component && Level == Other.Level;
+		}
+
+		friend uint32 GetTypeHash(const FPlanKey& Key)
+		{
+			uint32 Hash = HashCombine(HashCombine(uint32(Key.Kind), GetTypeHash(Key.ListClass)), GetTypeHash(Key.ContextClass));
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(Key.OwnerClass), GetTypeHash(Key.Archetype)));
+			return HashCombine(Hash, HashCombine(GetTypeHash(Key.Component), GetTypeHash(Key.Level)));
+		}
+	};
+
+	// Plans are heap-allocated so references stay valid while other threads add entries
+	TMap<FPlanKey, TUniquePtr<FKRollBindingPlan>> Plans;
+	FRWLock PlansLock;
+
+	struct FSeedEffect
+	{
+		uint32 Generation = 0;
+		TStrongObjectPtr<UGameplayEffect> Effect;
+	};
+
+	// Keyed by plan; plans live as long as the cache and are rebuilt in place on a new generation
+	TMap<const FKRollBindingPlan*, FSeedEffect> SeedEffects;
+
+	// Changed attributes of one ASC, sorted so every ASC with the same changes maps to the same key
+	struct FUpdateSeedKey
+	{
+		TArray<FKRollPlanEntry, TInlineAllocator<4>> Entries;
+
+		bool operator==(const FUpdateSeedKey& Other) const
+		{
+			if (Entries.Num() != Other.Entries.Num())
+			{
+				return false;
+			}
+			for (int32 Idx = 0; Idx < Entries.Num(); ++Idx)
+			{
+				if (Entries[Idx].Binding != Other.Entries[Idx].Binding || Entries[Idx].Key != Other.Entries[Idx].Key)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		friend uint32 GetTypeHash(const FUpdateSeedKey& Key)
+		{
+			uint32 Hash = 0;
+			for (const FKRollPlanEntry& Entry : Key.Entries)
+			{
+				Hash = HashCombine(Hash, HashCombine(GetTypeHash(Entry.Binding), GetTypeHash(Entry.Key)));
+			}
+			return Hash;
+		}
+	};
+
+	// Live update effects of the current generation only; dropped as soon as a newer one is seen
+	TMap<FUpdateSeedKey, TStrongObjectPtr<UGameplayEffect>> UpdateSeedEffects;
+	uint32 UpdateSeedGeneration = 0;
+
+	// Cache (weak keys avoid holding classes alive on hot reload). Values are heap-allocated: callers
+	// keep pointers to binding lists (gathered targets, bound properties) across later inserts.
+	TMap<TWeakObjectPtr<UClass>, TUniquePtr<FKRollClassBindings>> ActorCache;
+	TMap<TWeakObjectPtr<UClass>, TUniquePtr<TArray<FKRollPropertyBinding>>> AttributeSetCache;
+
+	// Bindings come from the manifest when one was given, otherwise from property metadata
+	TWeakObjectPtr<const UKRollBindingManifest> Manifest;
+
+	// A binding as declared, before it is compiled against the property
+	struct FBindingSpec
+	{
+		FProperty* Property = nullptr;
+
+		// Offset of the enclosing struct scope within the class
+		uint32 BaseOffset = 0;
+
+		// Dotted property path from the class ("Tuning.Speed")
+		FString Path;
+
+		FString Key;
+		FKRollTransform Transform;
+
+		// Unsupported types are only reported for explicit KRollKeys, not for struct scope members
+		bool bExplicitKey = true;
+	};
 
 	// Builders
-	static void CollectBindingsForClass(
+	void CollectBindingsForClass(
 		UClass* Class,
 		TArray<FKRollPropertyBinding>& Out,
 		bool bAllowGameplayAttributeData
-	);
+	) const;
+
+	static void GatherManifestSpecs(const FKRollManifestClass& Entry, const UClass* Class, TArray<FBindingSpec>& Out);
 
-	static bool TryBuildBindingFromProperty(
-		FProperty* Prop,
+	static constexpr int32 MaxStructDepth = 8;
+
+	static bool IsValueStruct(const UScriptStruct* Struct);
+
+	static bool BuildBinding(
+		const FBindingSpec& Spec,
 		FKRollPropertyBinding& Out,
 		bool bAllowGameplayAttributeData
 	);
 
+#if WITH_METADATA
+	// Struct members start at BaseOffset in the class; KeyPrefix is non-empty inside a KRollKey struct scope
+	static void GatherMetadataSpecs(
+		const UStruct* Struct,
+		uint32 BaseOffset,
+		const FString& PathPrefix,
+		const FString& KeyPrefix,
+		TArray<FBindingSpec>& Out,
+		int32 Depth
+	);
+
 	static void ParseTransformMeta(FProperty* Prop, FKRollTransform& Out);
 
 	static bool ParseOptionalDoubleMeta(FProperty* Prop, const TCHAR* MetaKey, TOptional<double>& OutVal);
 	static bool ParseDoubleMeta(FProperty* Prop, const TCHAR* MetaKey, double& OutVal);
+#endif
 };
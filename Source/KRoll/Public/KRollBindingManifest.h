@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPath.h"
+#include "KRollBindingManifest.generated.h"
+
+// One binding as found in property metadata at cook time
+USTRUCT()
+struct FKRollManifestBinding
+{
+	GENERATED_BODY()
+
+	// Property name, dotted through struct scopes ("Tuning.Speed"). Names rather than offsets:
+	// editor and cooked layouts differ (editor-only members), so offsets are taken at load.
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	FString PropertyPath;
+
+	// Key template, struct scope prefix included
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	FString Key;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	double Scale = 1.0;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	bool bHasClampMin = false;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	double ClampMin = 0.0;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	bool bHasClampMax = false;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	double ClampMax = 0.0;
+
+	// KRollDefault as written
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	bool bHasDefault = false;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	FString Default;
+
+	bool operator==(const FKRollManifestBinding& Other) const
+	{
+		return PropertyPath == Other.PropertyPath && Key.Equals(Other.Key, ESearchCase::CaseSensitive)
+			&& Scale == Other.Scale
+			&& bHasClampMin == Other.bHasClampMin && ClampMin == Other.ClampMin
+			&& bHasClampMax == Other.bHasClampMax && ClampMax == Other.ClampMax
+			&& bHasDefault == Other.bHasDefault && Default.Equals(Other.Default, ESearchCase::CaseSensitive);
+	}
+};
+
+// Every binding of one native class, inherited ones included
+USTRUCT()
+struct FKRollManifestClass
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	FSoftClassPath Class;
+
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	TArray<FKRollManifestBinding> Bindings;
+
+	bool operator==(const FKRollManifestClass& Other) const
+	{
+		return Class == Other.Class && Bindings == Other.Bindings;
+	}
+};
+
+/**
+	* Binding declarations compiled from KRoll property metadata, for builds that have no metadata
+	* (cooked games and servers). Regenerated when cooking and by -run=KRollBindingManifest.
+	*
+	* Only native classes are listed; Blueprint classes use their nearest native ancestor.
+	*/
+UCLASS()
+class KROLL_API UKRollBindingManifest : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Entry for Class or its nearest listed ancestor; null if none of them has bindings
+	const FKRollManifestClass* FindClass(const UClass* Class) const;
+
+	int32 NumClasses() const { return Classes.Num(); }
+
+	virtual void PostLoad() override;
+
+#if WITH_METADATA
+	// Rescans every loaded native class. True if the contents changed.
+	bool Rebuild();
+#endif
+
+private:
+	UPROPERTY(VisibleAnywhere, Category="KRoll")
+	TArray<FKRollManifestClass> Classes;
+
+	void BuildIndex();
+
+	// Class path -> index into Classes. Keyed by path rather than resolved class so classes from
+	// modules loaded after the manifest (game features) are found without re-indexing.
+	TMap<FTopLevelAssetPath, int32> ClassIndex;
+};
@@ -1,16 +1,36 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/TVariant.h"
+#include "KRollKeyHandle.h"
+#include "KRollKeyResolver.h"
 
 /**
-	* Supported target/value kinds for MVP bindings.
+	* Supported target/value kinds for bindings.
+	*
+	*  - Numeric kinds read numbers (Int64 prefers the exact integer view) and go through the transform.
+	*  - Enum reads a name (short or "EType::Name") or a number.
+	*  - Vector/Rotator/LinearColor read a JSON array or object ("x"/"pitch"/"r", ...), or text in
+	*    the engine's ToString() format; LinearColor also takes "#RRGGBB[AA]". Components are
+	*    transformed, except color alpha.
+	*  - FloatArray reads a JSON array of numbers; each element is transformed.
 	*/
 enum class EKRollValueKind : uint8
 {
 	Bool,
 	Int32,
 	Float,
-	GameplayAttributeData
+	GameplayAttributeData,
+	Double,
+	Int64,
+	Byte,
+	Enum,
+	Name,
+	String,
+	Vector,
+	Rotator,
+	LinearColor,
+	FloatArray
 };
 
 struct FKRollTransform
@@ -18,17 +38,113 @@ struct FKRollTransform
 	double Scale = 1.0;
 	TOptional<double> ClampMin;
 	TOptional<double> ClampMax;
+	// KRollDefault compiled for the binding's kind: the number (1/0 for bools, the value for enums)
 	TOptional<double> DefaultValue;
+
+	// KRollDefault as written; the default of text and struct kinds, parsed like a string value
+	TOptional<FString> DefaultText;
+};
+
+// Values that do not fit a write record; held by the plan and copied by the writer
+using FKRollPlanValue = TVariant<FString, FName, FVector, FRotator, FLinearColor, TArray<float>>;
+
+struct FKRollPlanWrite;
+
+// Stores a resolved value at its offset in the container. Never allocates beyond what the copy itself needs.
+using FKRollWriteFn = void (*)(uint8* Container, const FKRollPlanWrite& Write, const FKRollPlanValue* Values);
+
+/**
+	* Where and how a binding writes into its container, compiled from the property at cache build
+	* time so writes are plain stores at an offset (no CastField, no ContainerPtrToValuePtr).
+	*/
+struct FKRollPropertyWriter
+{
+	FKRollWriteFn Write = nullptr;
+
+	// Byte offset in the container; for bools, of the byte holding the bit
+	uint32 Offset = 0;
+
+	// Bools only: bits owned by the property, and the bits set for true (0xFF / 0x01 for native bools)
+	uint8 FieldMask = 0;
+	uint8 ByteMask = 0;
+
+	bool IsValid() const { return Write != nullptr; }
 };
 
 struct FKRollPropertyBinding
 {
-	// Property to write into (resolved at cache build time)
+	// Property the binding was compiled from; writes go through Writer, this is for diagnostics
+	// and for naming the attribute when seeding by GameplayEffect
 	FProperty* Property = nullptr;
 
+	FKRollPropertyWriter Writer;
+
 	// KRoll key template; may contain tokens like {archetype}, {class}
 	FName KeyTemplate;
 
+	// KeyTemplate parsed into segments at cache build time
+	FKRollKeyTemplate Template;
+
+	// Set only for templates without tokens: the key is the same for every target
+	FKRollKeyHandle StaticKey;
+
 	EKRollValueKind Kind = EKRollValueKind::Float;
 	FKRollTransform Transform;
+
+	// Enum kind: names are looked up in this enum
+	const UEnum* Enum = nullptr;
+};
+
+// One resolved value, packed with everything needed to store it
+struct FKRollPlanWrite
+{
+	FKRollWriteFn Write = nullptr;
+	uint32 Offset = 0;
+
+	// Plan entry the write was resolved for (FKRollBindingPlan::Entries)
+	int32 EntryIndex = INDEX_NONE;
+
+	EKRollValueKind Kind = EKRollValueKind::Float;
+	uint8 FieldMask = 0;
+	uint8 ByteMask = 0;
+
+	// Interpreted according to Kind; integer kinds (incl. enums) use IntValue, pooled kinds ValueIndex
+	union
+	{
+		bool BoolValue;
+		int64 IntValue;
+		float FloatValue;
+		double DoubleValue;
+		int32 ValueIndex;
+	};
+
+	FKRollPlanWrite() : IntValue(0) {}
+
+	void Apply(uint8* Container, const FKRollPlanValue* Values) const { Write(Container, *this, Values); }
+};
+
+// One binding with its key resolved; registered for live updates whether or not it has a value
+struct FKRollPlanEntry
+{
+	const FKRollPropertyBinding* Binding = nullptr;
+	FName Key;
+};
+
+/**
+	* A binding list compiled for one key context (class + archetype) against one snapshot.
+	* Every target sharing that context gets the same writes, so applying is a straight loop
+	* over the packed Writes array.
+	*/
+struct FKRollBindingPlan
+{
+	// Snapshot generation the values were read from; 0 = never built
+	uint32 Generation = 0;
+
+	// Only bindings with a value (found or defaulted), in binding order
+	TArray<FKRollPlanWrite> Writes;
+
+	// Strings, names, vectors, ... referenced by Writes[].ValueIndex
+	TArray<FKRollPlanValue> Values;
+
+	TArray<FKRollPlanEntry> Entries;
 };
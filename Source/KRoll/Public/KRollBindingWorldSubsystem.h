@@ -2,13 +2,83 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "KRollBindingCache.h"
 #include "KRollBindingWorldSubsystem.generated.h"
 
 class UKRollSubsystem;
+class UAbilitySystemComponent;
+class APawn;
+class AController;
+class ULevel;
 
+USTRUCT(BlueprintType)
+struct FKRollBindingQueueStats
+{
+	GENERATED_BODY()
+
+	// Actors waiting to have their bindings applied
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 QueueDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 PeakQueueDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 ProcessedLastFrame = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int64 TotalProcessed = 0;
+
+	// Spawns dropped without queueing because their class binds nothing
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int64 SkippedSpawns = 0;
+
+	// Time spent draining the queue last frame
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double DrainMsLastFrame = 0.0;
+
+	// Enqueue -> applied, over the actors processed last frame
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double AverageLatencyMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double MaxLatencyMs = 0.0;
+
+	// Last multi-actor apply (e.g. actors deferred until the first snapshot)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 LastBulkActors = 0;
+
+	// Actors, components and attribute sets with bindings in that pass
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 LastBulkTargets = 0;
+
+	// Key and value resolution (parallel)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double LastBulkResolveMs = 0.0;
+
+	// Property writes and registration (game thread)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double LastBulkCommitMs = 0.0;
+
+	// Replication nudges issued; each covers every attribute set seeded on its ASC that frame
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int64 ReplicationNudges = 0;
+
+	// Nudges a per-set seed would have issued on top of those
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int64 NudgesAvoided = 0;
+};
+
+/**
+	* Applies config bindings to authority actors as they spawn and re-applies them on live updates.
+	*
+	* Spawned actors go through one per-world queue that is drained each tick within
+	* UKRollSettings::BindingApplyBudgetMs; whatever does not fit carries over to the next frame.
+	* Seeded ASCs are nudged for replication once per frame, after all of that frame's writes.
+	*/
 UCLASS()
-class KROLL_API UKRollBindingWorldSubsystem : public UWorldSubsystem
+class KROLL_API UKRollBindingWorldSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -16,24 +86,142 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	UFUNCTION(BlueprintCallable, Category="KRoll")
 	void ApplyManual(AActor* Actor);
 
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	FKRollBindingQueueStats GetQueueStats() const { return QueueStats; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
 private:
 	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+	FDelegateHandle LevelRemovedHandle;
 
 	TObjectPtr<UKRollSubsystem> KRoll = nullptr;
 	TUniquePtr<FKRollBindingCache> Cache;
 
 	TSet<TWeakObjectPtr<AActor>> DeferredActors;
 
+	struct FPendingActor
+	{
+		TObjectKey<AActor> Actor;
+		double EnqueuedAt = 0.0;
+	};
+
+	// FIFO of actors to initialise; entries before PendingHead are already processed
+	TArray<FPendingActor> PendingActors;
+	int32 PendingHead = 0;
+
+	// Actors currently in PendingActors, so a spawn and an explicit re-queue collapse into one apply
+	TSet<TObjectKey<AActor>> QueuedActors;
+
+	FKRollBindingQueueStats QueueStats;
+
+	// ASCs with attribute sets seeded since the last flush, and how many sets were seeded
+	TSet<TObjectKey<UAbilitySystemComponent>> PendingNudges;
+	int32 PendingSeededSets = 0;
+
+	// One bound property of a live object, as registered when its bindings were applied
+	struct FKRollBoundProperty
+	{
+		TWeakObjectPtr<UObject> Target;
+
+		// Set for attribute set bindings, which are nudged through their ASC after seeding
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+
+		// Points into Cache, whose binding arrays never change once built
+		const FKRollPropertyBinding* Binding = nullptr;
+
+		TObjectKey<AActor> Owner;
+
+		// Index of this entry's FKRollBoundRef in BoundByActor[Owner]
+		int32 OwnerSlot = INDEX_NONE;
+
+		// Snapshot generation the value was last written from
+		uint32 Generation = 0;
+	};
+
+	// Where one of an actor's bound properties sits in BoundByKey
+	struct FKRollBoundRef
+	{
+		FName Key;
+		int32 Index = INDEX_NONE;
+	};
+
+	// Resolved key -> properties bound to it; live updates rewrite only the properties of changed keys
+	TMap<FName, TArray<FKRollBoundProperty>> BoundByKey;
+
+	// Each actor's entries in BoundByKey, so a re-apply or destruction unregisters it without scanning
+	// the buckets (entries are removed by swap, and the moved entry's ref is patched)
+	TMap<TObjectKey<AActor>, TArray<FKRollBoundRef>> BoundByActor;
+
+	FDelegateHandle KeysChangedHandle;
+
+	// Where an actor's attribute sets live and which actor their keys resolve against
+	struct FKRollActorContext
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		TWeakObjectPtr<AActor> KeyContext;
+	};
+
+	// Per actor, so re-applies skip the pawn/controller/player state/owner walk. Only found ASCs are
+	// cached: one added or initialised later is picked up on the next apply. Cleared on any possession
+	// change, per actor on ApplyManual and per level on streaming unload; entries whose ASC or context
+	// actor died are re-resolved.
+	TMap<TObjectKey<AActor>, FKRollActorContext> ActorContexts;
+
+	// One object with bindings, gathered on the game thread; Plan is filled in by the resolve phase
+	struct FKRollBindingTarget
+	{
+		UObject* Target = nullptr;
+		const TArray<FKRollPropertyBinding>* Bindings = nullptr;
+		const UObject* KeyContext = nullptr;
+		AActor* Actor = nullptr;
+
+		// Set for attribute sets
+		UAbilitySystemComponent* ASC = nullptr;
+
+		const FKRollBindingPlan* Plan = nullptr;
+	};
+
 	void HandleActorSpawned(AActor* Actor);
-	void ScheduleInitNextTick(AActor* Actor);
+	void EnqueueActor(AActor* Actor);
+
+	// False for actors whose class has no bindings of any kind and that cannot reach an ASC
+	bool HasBindingWork(AActor* Actor) const;
+	void DrainQueue();
+
+	void QueueNudge(UAbilitySystemComponent* ASC);
+	void FlushNudges();
 	void TryInitActorNow(AActor* Actor);
 
+	// Gathers targets, resolves their plans in parallel and commits the writes on the game thread
+	void ApplyActors(TConstArrayView<AActor*> Actors);
+	void GatherTargets(AActor* Actor, TArray<FKRollBindingTarget>& OutTargets);
+	UAbilitySystemComponent* ResolveActorContext(AActor* Actor, const FKRollClassBindings& Bindings, AActor*& OutKeyContext);
+
+	UFUNCTION()
+	void HandlePawnControllerChanged(APawn* Pawn, AController* Controller);
+
+	void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
 	UFUNCTION()
 	void OnConfigReady();
 
-	void ApplyActorAndComponents(AActor* Actor);
-	void ApplyAttributeSets(AActor* Actor);
+	void RegisterBoundProperties(AActor* Actor, UObject* Target, UAbilitySystemComponent* ASC, const FKRollBindingPlan& Plan);
+	void UnregisterActor(TObjectKey<AActor> ActorKey);
+
+	void HandleKeysChanged(TConstArrayView<FName> ChangedKeys);
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* Actor);
+
+	// Classes collected or replaced by a reload take their cached bindings and plans with them
+	void HandlePostGarbageCollect();
 };
@@ -24,4 +24,17 @@ public:
 	UFUNCTION(BlueprintPure, Category="KRoll")
 	static FString GetJson(const FString& Key);
 
+	// Name pins are built once when the graph is compiled, so these skip the per-call key conversion
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	static bool GetBoolByName(FName Key, bool DefaultValue);
+
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	static FString GetStringByName(FName Key, const FString& DefaultValue);
+
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	static float GetNumberByName(FName Key, float DefaultValue);
+
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	static FString GetJsonByName(FName Key);
+
 };
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KRollSnapshot.h"
+
+#include <atomic>
+
+/**
+	* A key resolved once into a snapshot slot index.
+	*
+	* The handle remembers (generation, slot) of the last snapshot it was resolved against and
+	* only repeats the map probe when a different snapshot is read. Repeated reads of the same
+	* snapshot are a compare plus array index. Safe to share between threads.
+	*
+	* Handles made by KROLL_KEY hold a string literal and its compile-time hash instead of an FName
+	* and probe the snapshot's own hash table, so they never touch the name table.
+	*/
+struct KROLL_API FKRollKeyHandle
+{
+public:
+	// A key string with static storage duration and its FKRollKeyHash
+	struct FLiteral
+	{
+		const UTF8CHAR* Str = nullptr;
+		int32 Len = 0;
+		uint64 Hash = 0;
+	};
+
+	FKRollKeyHandle() = default;
+	explicit FKRollKeyHandle(FName InKey) : Key(InKey) {}
+	explicit FKRollKeyHandle(const FLiteral& InLiteral) : Literal(InLiteral) {}
+
+	FKRollKeyHandle(const FKRollKeyHandle& Other)
+		: Key(Other.Key)
+		, Literal(Other.Literal)
+		, Cached(Other.Cached.load(std::memory_order_relaxed))
+	{
+	}
+
+	FKRollKeyHandle& operator=(const FKRollKeyHandle& Other)
+	{
+		Key = Other.Key;
+		Literal = Other.Literal;
+		Cached.store(Other.Cached.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
+
+	// Literal handles create the FName here, on request only
+	FName GetKey() const { return Literal.Str ? FName(FUtf8StringView(Literal.Str, Literal.Len)) : Key; }
+	bool IsSet() const { return Literal.Str != nullptr || !Key.IsNone(); }
+
+	// Slot index for this key in Snapshot, or INDEX_NONE if the key is not present
+	int32 Resolve(const FKRollSnapshot& Snapshot) const;
+
+private:
+	FName Key;
+	FLiteral Literal;
+
+	// (Generation << 32) | (SlotIndex + 1); zero low bits mean "not present", generation 0 means "never resolved"
+	mutable std::atomic<uint64> Cached{0};
+};
+
+/**
+	* Handle for a fixed key, hashed at compile time and shared by every use of that expression:
+	*
+	*   const double Health = FKRollAPI::GetNumber(KROLL_KEY("characters.zombie.health"), 100.0);
+	*/
+#define KROLL_KEY(KeyLiteral) \
+	([]() -> const FKRollKeyHandle& \
+	{ \
+		static_assert(sizeof(KeyLiteral) > 1, "KROLL_KEY needs a non-empty string literal"); \
+		static_assert(sizeof(KeyLiteral[0]) == 1, "KROLL_KEY takes a plain literal: \"key\", not TEXT(\"key\")"); \
+		static constexpr uint64 KeyHash = FKRollKeyHash::Compute(KeyLiteral, int32(sizeof(KeyLiteral) - 1)); \
+		static const FKRollKeyHandle Handle(FKRollKeyHandle::FLiteral{ \
+			reinterpret_cast<const UTF8CHAR*>(KeyLiteral), int32(sizeof(KeyLiteral) - 1), KeyHash}); \
+		return Handle; \
+	}())
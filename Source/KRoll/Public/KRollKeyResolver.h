@@ -2,24 +2,75 @@
 
 #include "CoreMinimal.h"
 
+enum class EKRollKeyToken : uint8
+{
+	Literal,
+	Archetype,
+	Class,
+	Component,
+	Level
+};
+
+/**
+	* A key template parsed once into literal and token segments, e.g.
+	* "characters.{archetype}.health" -> [ "characters." ][ {archetype} ][ ".health" ].
+	*
+	* Unknown tokens and unbalanced braces are detected when the template is compiled,
+	* so resolving never has to scan the result for leftover '{'.
+	*/
+struct KROLL_API FKRollKeyTemplate
+{
+	struct FSegment
+	{
+		EKRollKeyToken Token = EKRollKeyToken::Literal;
+		FString Literal;
+	};
+
+	TArray<FSegment> Segments;
+
+	// Bit (1 << EKRollKeyToken) per token used
+	uint8 TokenMask = 0;
+
+	bool bValid = false;
+
+	static FKRollKeyTemplate Compile(const FString& Source, FString* OutError = nullptr);
+
+	bool IsValid() const { return bValid; }
+	bool HasTokens() const { return TokenMask != 0; }
+	bool Uses(EKRollKeyToken Token) const { return (TokenMask & (1 << uint8(Token))) != 0; }
+};
+
 /**
 	* Resolves KRoll key templates using lightweight tokens.
 	*
-	* Supported tokens (MVP):
+	* Supported tokens:
 	*  - {archetype}: Actor.KRollArchetype (FName) if present, else {class}
 	*  - {class}: normalized class name
+	*  - {component}: name of the bound component (component bindings only)
+	*  - {level}: short name of the level the actor lives in
 	*
 	* Note: For components / attribute sets, archetype resolution is based on the outer Actor if possible.
 	*/
 class KROLL_API FKRollKeyResolver
 {
 public:
+	// {archetype}, {class} and {level} resolve against KeyContext; {component} against Target.
+	// NAME_None if a token has no value for these objects.
+	static FName ResolveKey(const FKRollKeyTemplate& Template, const UObject* Target, const UObject* KeyContext);
+
+	// Compiles KeyTemplate on every call; prefer the FKRollKeyTemplate overload
 	static FName ResolveKey(const UObject* Target, const FName& KeyTemplate);
 
-private:
 	static const AActor* ResolveOwningActor(const UObject* Target);
+
+	// KRollArchetype of Target's owning actor, or NAME_None. The property lookup is cached per class.
+	static FName GetArchetypeName(const UObject* Target);
+
+private:
 	static FString ResolveArchetypeToken(const UObject* Target);
 	static FString ResolveClassToken(const UObject* Target);
+	static bool ResolveComponentToken(const UObject* Target, FString& Out);
+	static bool ResolveLevelToken(const UObject* Target, FString& Out);
 	static bool TryGetArchetypeFromActor(const AActor* Actor, FString& OutLower);
 	static FString NormalizeClassName(FString In);
 };
@@ -7,6 +7,8 @@ static constexpr uint32 KROLL_REASON_UNSUPPORTED_PROP = 1;
 static constexpr uint32 KROLL_REASON_BAD_META_NUMERIC = 2;
 static constexpr uint32 KROLL_REASON_UNRESOLVED_TOKEN = 3;
 static constexpr uint32 KROLL_REASON_MISSING_KEY      = 4;
+static constexpr uint32 KROLL_REASON_BAD_VALUE        = 5;
+static constexpr uint32 KROLL_REASON_NESTED_ATTRIBUTE = 6;
 
 class FKRollLogOnce
 {
@@ -4,6 +4,28 @@
 #include "Engine/DeveloperSettings.h"
 #include "KRollSettings.generated.h"
 
+// Priority of the worker task that parses a fetched payload and builds the snapshot
+UENUM()
+enum class EKRollSnapshotBuildPriority : uint8
+{
+	High,
+	Normal,
+	BackgroundHigh,
+	BackgroundNormal,
+	BackgroundLow
+};
+
+// How bound FGameplayAttributeData members of attribute sets receive their values
+UENUM()
+enum class EKRollAttributeSeedMode : uint8
+{
+	// Base and current value are written in place; no aggregator, PreAttributeBaseChange or delegates
+	DirectWrite,
+
+	// One cached instant GameplayEffect with an Override modifier per attribute, applied to the ASC
+	GameplayEffect
+};
+
 UCLASS(Config=Game, DefaultConfig, meta=(DisplayName="KRoll"))
 class KROLL_API UKRollSettings : public UDeveloperSettings
 {
@@ -17,11 +39,91 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Connection")
 	FString ApiKey;
 
-	// If true, FetchConfigs() called automatically on subsystem Initialize
+	// If true, FetchConfigs() called automatically on subsystem Initialize. With bAutoRefresh the
+	// first fetch otherwise happens on the subsystem's first tick.
 	UPROPERTY(Config, EditAnywhere, Category="Behavior")
 	bool bAutoFetchOnInit = false;
 
 	// If true, allow mild coercions (e.g., "true"/"1" -> bool, numeric strings -> number)
 	UPROPERTY(Config, EditAnywhere, Category="Behavior")
 	bool bAllowTypeCoercion = true;
+
+	// If true, fetches send the current snapshot id/hash (and If-None-Match) so an unchanged
+	// snapshot costs a 304 instead of a full download, parse and OnConfigReady re-broadcast
+	UPROPERTY(Config, EditAnywhere, Category="Behavior")
+	bool bConditionalFetch = true;
+
+	// If true, the last good snapshot is saved under Saved/KRoll and loaded on Initialize,
+	// so values are available before the first fetch completes
+	UPROPERTY(Config, EditAnywhere, Category="Behavior")
+	bool bPersistSnapshot = true;
+
+	// If true, fetches also accept the compiled binary snapshot format, which is read in place
+	// without parsing. Only enable against a backend that serves application/x-kroll-snapshot;
+	// JSON responses keep working either way.
+	UPROPERTY(Config, EditAnywhere, Category="Behavior")
+	bool bAcceptBinarySnapshot = false;
+
+	// If true, the subsystem polls for new snapshots on its own and retries failed fetches
+	UPROPERTY(Config, EditAnywhere, Category="Refresh")
+	bool bAutoRefresh = false;
+
+	UPROPERTY(Config, EditAnywhere, Category="Refresh", meta=(ClampMin="5", EditCondition="bAutoRefresh"))
+	float RefreshIntervalSeconds = 60.f;
+
+	// Each interval is randomized by +/- this fraction
+	UPROPERTY(Config, EditAnywhere, Category="Refresh", meta=(ClampMin="0", ClampMax="1", EditCondition="bAutoRefresh"))
+	float RefreshJitter = 0.2f;
+
+	// Failed fetches, and responses that cannot be turned into a snapshot, back off exponentially
+	// from the initial delay up to the max
+	UPROPERTY(Config, EditAnywhere, Category="Refresh", meta=(ClampMin="0.1", EditCondition="bAutoRefresh"))
+	float RetryInitialDelaySeconds = 2.f;
+
+	UPROPERTY(Config, EditAnywhere, Category="Refresh", meta=(ClampMin="1", EditCondition="bAutoRefresh"))
+	float RetryMaxDelaySeconds = 300.f;
+
+	// Applies to every fetch; 0 uses the HTTP module default
+	UPROPERTY(Config, EditAnywhere, Category="Refresh", meta=(ClampMin="0"))
+	float RequestTimeoutSeconds = 15.f;
+
+	// Parsing and snapshot construction run off the game thread at this priority
+	UPROPERTY(Config, EditAnywhere, Category="Performance")
+	EKRollSnapshotBuildPriority SnapshotBuildPriority = EKRollSnapshotBuildPriority::BackgroundNormal;
+
+	// If true, fetches offer compressed payloads (Oodle when available, gzip, deflate);
+	// decompression runs on the same worker task as the parse
+	UPROPERTY(Config, EditAnywhere, Category="Performance")
+	bool bRequestCompression = true;
+
+	// Compressed responses that would inflate beyond this are rejected
+	UPROPERTY(Config, EditAnywhere, Category="Performance", meta=(ClampMin="1", ClampMax="2047"))
+	int32 MaxSnapshotMegabytes = 256;
+
+	// Per-frame time spent applying bindings to newly spawned actors; the rest waits for the next frame.
+	// At least one actor is applied per frame. 0 = no limit.
+	UPROPERTY(Config, EditAnywhere, Category="Performance", meta=(ClampMin="0", Units="ms"))
+	float BindingApplyBudgetMs = 2.f;
+
+	// If true, multi-actor applies (e.g. actors deferred until the first snapshot) resolve keys and
+	// values on worker threads; property writes always happen on the game thread
+	UPROPERTY(Config, EditAnywhere, Category="Performance")
+	bool bParallelBindingResolve = true;
+
+	// Below this many bound objects the resolve phase stays on the game thread
+	UPROPERTY(Config, EditAnywhere, Category="Performance", meta=(ClampMin="1", EditCondition="bParallelBindingResolve"))
+	int32 ParallelResolveMinTargets = 64;
+
+	// Bindings compiled from property metadata, for builds that have none (cooked games and servers).
+	// Regenerated on every cook and by -run=KRollBindingManifest.
+	UPROPERTY(Config, EditAnywhere, Category="Bindings", meta=(AllowedClasses="/Script/KRoll.KRollBindingManifest"))
+	FSoftObjectPath BindingManifest = FSoftObjectPath(TEXT("/Game/KRoll/KRollBindingManifest.KRollBindingManifest"));
+
+	// Builds with metadata read it directly unless this is set (e.g. to test the manifest in PIE)
+	UPROPERTY(Config, EditAnywhere, Category="Bindings")
+	bool bUseBindingManifestInEditor = false;
+
+	// GameplayEffect seeding runs attribute set callbacks and keeps active modifiers on top of the new base
+	UPROPERTY(Config, EditAnywhere, Category="Bindings")
+	EKRollAttributeSeedMode AttributeSeedMode = EKRollAttributeSeedMode::DirectWrite;
 };
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "KRollSnapshot.generated.h"
+
+/**
+	* Which typed views of a value were resolved when the snapshot was built.
+	* Coercions (e.g. "yes" -> bool) are decided once, at publish time.
+	*/
+enum class EKRollSlotFlags : uint8
+{
+	None    = 0,
+	Bool    = 1 << 0,
+	Number  = 1 << 1,
+	Integer = 1 << 2,
+	String  = 1 << 3,
+};
+ENUM_CLASS_FLAGS(EKRollSlotFlags);
+
+/**
+	* A single pre-typed, pre-coerced value, as produced by the parser.
+	* Slots are the build-time input of a snapshot; reads go through FKRollSnapshot.
+	*/
+struct KROLL_API FKRollValueSlot
+{
+	// Original JSON type of the value
+	EJson Type = EJson::None;
+
+	// Typed views available for this value
+	EKRollSlotFlags Available = EKRollSlotFlags::None;
+
+	bool BoolValue = false;
+	double NumberValue = 0.0;
+	int64 IntegerValue = 0;
+	FString StringValue;
+
+	// Source text for object/array values; parsed into a DOM only when GetJson() asks for it
+	FString RawJson;
+
+	bool Has(EKRollSlotFlags Flag) const { return EnumHasAnyFlags(Available, Flag); }
+
+	static FKRollValueSlot MakeBool(bool Value, bool bAllowTypeCoercion);
+	static FKRollValueSlot MakeNumber(double Value, bool bAllowTypeCoercion);
+	static FKRollValueSlot MakeString(FString&& Value, bool bAllowTypeCoercion);
+	static FKRollValueSlot MakeNull();
+	static FKRollValueSlot MakeRawJson(EJson Type, FString&& Text);
+};
+
+USTRUCT(BlueprintType)
+struct FKRollSnapshotMeta
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	int32 SchemaVersion = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	FString ActiveSnapshotId;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	FString ActiveSnapshotHash;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	FDateTime PublishedAt;
+
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	FString Label;
+
+	bool IsValid() const
+	{
+		return SchemaVersion > 0 && !ActiveSnapshotId.IsEmpty();
+	}
+};
+
+/**
+	* Case-insensitive (ASCII) FNV-1a over UTF-8 key bytes; the hash stored in the
+	* binary snapshot key table. constexpr so fixed keys can be hashed at compile time.
+	*/
+struct FKRollKeyHash
+{
+	static constexpr uint64 Offset = 0xcbf29ce484222325ull;
+	static constexpr uint64 Prime  = 0x00000100000001b3ull;
+
+	static constexpr uint64 Step(uint64 Hash, uint8 Char)
+	{
+		return (Hash ^ uint64((Char >= 'A' && Char <= 'Z') ? Char + ('a' - 'A') : Char)) * Prime;
+	}
+
+	template <typename CharType>
+	static constexpr uint64 Compute(const CharType* Str, int32 Len)
+	{
+		uint64 Hash = Offset;
+		for (int32 Idx = 0; Idx < Len; ++Idx)
+		{
+			Hash = Step(Hash, uint8(Str[Idx]));
+		}
+		return Hash;
+	}
+
+	static uint64 Compute(FUtf8StringView Key) { return Compute(Key.GetData(), Key.Len()); }
+};
+
+/**
+	* KRoll binary snapshot ("KRSB"): one contiguous, little-endian blob that is read in place.
+	*
+	*   [Header][KeyHashes u64 x N][Numbers f64 x N][Integers i64 x N][Entries x N][Buckets u32 x B][String pool]
+	*
+	* Buckets form an open-addressing table (B is a power of two > N) holding entry index + 1.
+	* Strings (keys, string values, raw JSON of objects/arrays, meta) are UTF-8 ranges in the pool.
+	*/
+struct FKRollBlobString
+{
+	uint32 Offset = 0;
+	uint32 Len = 0;
+};
+
+struct FKRollBlobEntry
+{
+	FKRollBlobString Key;
+	FKRollBlobString Text;
+	uint8 Type = 0;      // EJson
+	uint8 Available = 0; // EKRollSlotFlags
+	uint8 BoolValue = 0;
+	uint8 Reserved[5] = {};
+};
+static_assert(sizeof(FKRollBlobEntry) == 24, "KRoll blob entry layout changed");
+
+struct FKRollBlobHeader
+{
+	static constexpr uint32 MagicValue     = 0x4253524B; // "KRSB"
+	static constexpr uint16 CurrentVersion = 1;
+
+	static constexpr uint16 FlagHasMeta      = 1 << 0;
+	static constexpr uint16 FlagTypeCoercion = 1 << 1;
+
+	uint32 Magic = MagicValue;
+	uint16 Version = CurrentVersion;
+	uint16 Flags = 0;
+	uint64 BlobSize = 0;
+	uint32 Crc = 0; // CRC32 of everything after the header
+	uint32 NumEntries = 0;
+	uint32 NumBuckets = 0;
+	uint32 KeyHashesOffset = 0;
+	uint32 NumbersOffset = 0;
+	uint32 IntegersOffset = 0;
+	uint32 EntriesOffset = 0;
+	uint32 BucketsOffset = 0;
+	uint32 PoolOffset = 0;
+	uint32 PoolSize = 0;
+	int32 SchemaVersion = 0;
+	uint32 Reserved = 0;
+	int64 PublishedAtTicks = 0;
+	FKRollBlobString SnapshotId;
+	FKRollBlobString SnapshotHash;
+	FKRollBlobString Label;
+};
+static_assert(sizeof(FKRollBlobHeader) == 96, "KRoll blob header layout changed");
+
+// Backing memory of a snapshot blob (owned array, mapped file, HTTP response, ...)
+class IKRollSnapshotStorage
+{
+public:
+	virtual ~IKRollSnapshotStorage() = default;
+	virtual TConstArrayView64<uint8> GetBytes() const = 0;
+};
+
+class FKRollSnapshot;
+using FKRollSnapshotPtr = TSharedPtr<const FKRollSnapshot, ESPMode::ThreadSafe>;
+
+/**
+	* Immutable, reference-counted view of one published config snapshot.
+	* Values and meta always come from the same fetch; the generation number is
+	* unique per process and changes with every publish.
+	*
+	* Values are served straight from the binary blob: a lookup yields a slot index and
+	* typed reads are loads from the matching column. Only the FName index and the FString copies of
+	* string values are built on load.
+	*/
+class KROLL_API FKRollSnapshot : public TSharedFromThis<FKRollSnapshot, ESPMode::ThreadSafe>
+{
+public:
+	// Compiles parsed slots into a new blob; null if the blob would exceed 2 GiB
+	static FKRollSnapshotPtr Build(TMap<FName, FKRollValueSlot>&& Values, const FKRollSnapshotMeta* Meta, bool bAllowTypeCoercion, FString* OutError = nullptr);
+
+	// Wraps an existing blob after validating it; null if it is not a well-formed KRoll snapshot
+	static FKRollSnapshotPtr FromStorage(TUniquePtr<IKRollSnapshotStorage>&& Storage, FString* OutError = nullptr);
+	static FKRollSnapshotPtr FromBytes(TArray64<uint8>&& Bytes, FString* OutError = nullptr);
+
+	// Memory-maps the file when the platform allows it (loose files), otherwise reads it (e.g. from pak)
+	static FKRollSnapshotPtr FromFile(const FString& Path, FString* OutError = nullptr);
+
+	uint32 GetGeneration() const { return Generation; }
+
+	bool HasMeta() const { return bHasMeta; }
+	const FKRollSnapshotMeta& GetMeta() const { return Meta; }
+
+	// Coercion policy the typed views were compiled with
+	bool WasBuiltWithTypeCoercion() const { return (Header->Flags & FKRollBlobHeader::FlagTypeCoercion) != 0; }
+
+	TConstArrayView64<uint8> GetBlob() const { return TConstArrayView64<uint8>(Data, int64(Header->BlobSize)); }
+
+	int32 Num() const { return int32(Header->NumEntries); }
+
+	int32 FindIndex(FName Key) const
+	{
+		const int32* Found = Index.Find(Key);
+		return Found ? *Found : INDEX_NONE;
+	}
+
+	// Lookup through the blob's own hash table; no FName involved
+	int32 FindIndex(FUtf8StringView Key) const { return FindIndex(FKRollKeyHash::Compute(Key), Key); }
+	int32 FindIndex(uint64 KeyHash, FUtf8StringView Key) const;
+
+	bool IsValidIndex(int32 SlotIndex) const { return uint32(SlotIndex) < Header->NumEntries; }
+
+	FName GetKey(int32 SlotIndex) const
+	{
+		return Keys.IsValidIndex(SlotIndex) ? Keys[SlotIndex] : NAME_None;
+	}
+
+	uint64 GetKeyHash(int32 SlotIndex) const
+	{
+		return IsValidIndex(SlotIndex) ? KeyHashes[SlotIndex] : 0;
+	}
+
+	FUtf8StringView GetKeyUtf8(int32 SlotIndex) const
+	{
+		return IsValidIndex(SlotIndex) ? GetPoolString(Entries[SlotIndex].Key) : FUtf8StringView();
+	}
+
+	// True if both slots hold the same source value and the same typed views
+	bool IsSameValue(int32 SlotIndex, const FKRollSnapshot& Other, int32 OtherIndex) const;
+
+	EJson GetType(int32 SlotIndex) const
+	{
+		return IsValidIndex(SlotIndex) ? static_cast<EJson>(Entries[SlotIndex].Type) : EJson::None;
+	}
+
+	bool TryGetBool(int32 SlotIndex, bool& OutValue) const
+	{
+		if (!HasView(SlotIndex, EKRollSlotFlags::Bool))
+		{
+			return false;
+		}
+		OutValue = Entries[SlotIndex].BoolValue != 0;
+		return true;
+	}
+
+	bool TryGetNumber(int32 SlotIndex, double& OutValue) const
+	{
+		if (!HasView(SlotIndex, EKRollSlotFlags::Number))
+		{
+			return false;
+		}
+		OutValue = Numbers[SlotIndex];
+		return true;
+	}
+
+	bool TryGetInteger(int32 SlotIndex, int64& OutValue) const
+	{
+		if (!HasView(SlotIndex, EKRollSlotFlags::Integer))
+		{
+			return false;
+		}
+		OutValue = Integers[SlotIndex];
+		return true;
+	}
+
+	// Zero-copy view into the string pool
+	bool TryGetUtf8(int32 SlotIndex, FUtf8StringView& OutValue) const
+	{
+		if (!HasView(SlotIndex, EKRollSlotFlags::String))
+		{
+			return false;
+		}
+		OutValue = GetPoolString(Entries[SlotIndex].Text);
+		return true;
+	}
+
+	bool TryGetString(int32 SlotIndex, FString& OutValue) const
+	{
+		if (!HasView(SlotIndex, EKRollSlotFlags::String))
+		{
+			return false;
+		}
+		OutValue = Strings[SlotIndex];
+		return true;
+	}
+
+	// Builds a DOM value on demand (cold path)
+	TSharedPtr<FJsonValue> GetJson(int32 SlotIndex) const;
+
+private:
+	FKRollSnapshot() = default;
+
+	bool Attach(TUniquePtr<IKRollSnapshotStorage>&& InStorage, FString* OutError);
+
+	bool HasView(int32 SlotIndex, EKRollSlotFlags Flag) const
+	{
+		return IsValidIndex(SlotIndex) && EnumHasAnyFlags(static_cast<EKRollSlotFlags>(Entries[SlotIndex].Available), Flag);
+	}
+
+	FUtf8StringView GetPoolString(const FKRollBlobString& Str) const
+	{
+		return FUtf8StringView(Pool + Str.Offset, int32(Str.Len));
+	}
+
+	TUniquePtr<IKRollSnapshotStorage> Storage;
+
+	// Views into the blob
+	const uint8* Data = nullptr;
+	const FKRollBlobHeader* Header = nullptr;
+	const uint64* KeyHashes = nullptr;
+	const double* Numbers = nullptr;
+	const int64* Integers = nullptr;
+	const FKRollBlobEntry* Entries = nullptr;
+	const uint32* Buckets = nullptr;
+	const UTF8CHAR* Pool = nullptr;
+
+	// FName lookup index, built once on attach
+	TArray<FName> Keys;
+	TMap<FName, int32> Index;
+
+	// String views as FString, converted once on attach; empty for slots without one
+	TArray<FString> Strings;
+
+	FKRollSnapshotMeta Meta;
+	bool bHasMeta = false;
+
+	uint32 Generation = 0;
+};
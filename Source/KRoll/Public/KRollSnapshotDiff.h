@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KRollSnapshot.h"
+
+/**
+	* Keys that differ between two snapshots.
+	*
+	* Computed by probing the old snapshot's key table with each new key (no FName or string
+	* allocations), so the cost is linear in the number of keys and runs fine on a worker.
+	*/
+struct KROLL_API FKRollSnapshotDiff
+{
+	// Generation the diff was computed against; 0 when there was no previous snapshot
+	uint32 FromGeneration = 0;
+	uint32 ToGeneration = 0;
+
+	TArray<FName> Added;
+	TArray<FName> Removed;
+	TArray<FName> Changed;
+
+	bool IsEmpty() const { return Added.IsEmpty() && Removed.IsEmpty() && Changed.IsEmpty(); }
+	int32 Num() const { return Added.Num() + Removed.Num() + Changed.Num(); }
+
+	// Old may be null (first snapshot): every key of New is reported as added
+	static FKRollSnapshotDiff Compute(const FKRollSnapshot* Old, const FKRollSnapshot& New);
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KRollSnapshot.h"
+
+/**
+	* Last-good snapshot persisted to disk so the game is ready before the first fetch returns.
+	*
+	* The file is the snapshot's binary blob as-is (see FKRollBlobHeader). It is read into memory
+	* rather than mapped: the next Save replaces the file while that snapshot is still live, which a
+	* mapping would block on Windows. Anything that does not verify, or lacks a snapshot hash, is discarded.
+	*/
+class KROLL_API FKRollSnapshotFile
+{
+public:
+	static FString GetDefaultPath();
+
+	// Only snapshots with meta (and therefore a hash to verify against) are written. Thread-safe.
+	static bool Save(const FKRollSnapshot& Snapshot, const FString& Path);
+
+	// Null if missing, corrupt, without meta hash or built with a different coercion policy
+	static FKRollSnapshotPtr Load(const FString& Path, bool bAllowTypeCoercion);
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KRollSnapshot.h"
+
+/**
+	* Streaming parser for the fetch envelope:
+	*   { "meta": { ... }, "values": { "<key>": <value>, ... } }
+	*
+	* Reads the raw UTF-8 response bytes in one forward pass and emits compiled slots
+	* directly; no TCHAR copy of the body and no JSON DOM are created. Object/array
+	* values are kept as their source text and only parsed if GetJson() requests them.
+	*/
+class KROLL_API FKRollSnapshotParser
+{
+public:
+	struct FResult
+	{
+		TMap<FName, FKRollValueSlot> Values;
+		FKRollSnapshotMeta Meta;
+		bool bHasMeta = false;
+	};
+
+	// False if the payload is not a JSON object with a "values" object
+	static bool Parse(TConstArrayView<uint8> Utf8, bool bAllowTypeCoercion, FResult& Out);
+};
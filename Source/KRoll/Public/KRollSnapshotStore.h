@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "KRollSnapshot.h"
+
+#include <atomic>
+
+/**
+	* Publishes immutable snapshots to readers on any thread (read-copy-update).
+	*
+	*  - Readers open an FReadScope: two atomic ops, no lock, never blocked by a publish.
+	*  - Publish() swaps the current pointer; the previous snapshot stays alive until every
+	*    reader that could have seen it has left its scope (checked by Reclaim()).
+	*  - Readers that need a snapshot beyond a scope take a strong ref with Pin().
+	*
+	* Publish/Reclaim/Reset are game-thread only. Read scopes must be short-lived.
+	*/
+class KROLL_API FKRollSnapshotStore
+{
+public:
+	class KROLL_API FReadScope
+	{
+	public:
+		explicit FReadScope(const FKRollSnapshotStore& InStore);
+		~FReadScope();
+
+		FReadScope(const FReadScope&) = delete;
+		FReadScope& operator=(const FReadScope&) = delete;
+
+		const FKRollSnapshot* Get() const { return Snapshot; }
+		const FKRollSnapshot* operator->() const { return Snapshot; }
+		explicit operator bool() const { return Snapshot != nullptr; }
+
+	private:
+		const FKRollSnapshotStore& Store;
+		uint32 Side = 0;
+		const FKRollSnapshot* Snapshot = nullptr;
+	};
+
+	FKRollSnapshotStore() = default;
+	~FKRollSnapshotStore();
+
+	FKRollSnapshotStore(const FKRollSnapshotStore&) = delete;
+	FKRollSnapshotStore& operator=(const FKRollSnapshotStore&) = delete;
+
+	bool IsPublished() const { return Current.load() != nullptr; }
+
+	// Strong reference to the current snapshot (may be null)
+	FKRollSnapshotPtr Pin() const;
+
+	// Game thread
+	void Publish(FKRollSnapshotPtr NewSnapshot);
+	void Reclaim();
+	void Reset();
+
+	bool HasPendingReclaim() const { return GraceBatch.Num() > 0 || Retired.Num() > 0; }
+
+private:
+	std::atomic<const FKRollSnapshot*> Current{nullptr};
+
+	// Readers register on the active side; a flip lets the other side drain.
+	std::atomic<uint32> ActiveSide{0};
+	mutable std::atomic<int32> Readers[2] = {};
+
+	// Game-thread state
+	FKRollSnapshotPtr CurrentOwner;
+	TArray<FKRollSnapshotPtr> Retired;
+	TArray<FKRollSnapshotPtr> GraceBatch;
+	bool bSideDrained[2] = { false, false };
+
+	void WaitForReaders() const;
+};
+
+// Shared so readers outside the owner (FKRollAPI) can keep a store alive while they read it
+using FKRollSnapshotStoreRef = TSharedRef<FKRollSnapshotStore, ESPMode::ThreadSafe>;
+using FKRollSnapshotStorePtr = TSharedPtr<FKRollSnapshotStore, ESPMode::ThreadSafe>;
@@ -4,36 +4,78 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Http.h"
 #include "Dom/JsonObject.h"
+#include "Containers/Ticker.h"
+#include "KRollSnapshotStore.h"
+#include "KRollKeyHandle.h"
 #include "KRollSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FKrollConfigReadyDelegate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FKRollKeysChangedMulticast, const TArray<FName>&, ChangedKeys);
+
+// Added, removed or changed keys matching a subscription, delivered once per frame
+DECLARE_DELEGATE_OneParam(FKRollKeysChangedDelegate, TConstArrayView<FName> /*ChangedKeys*/);
+
+struct FKRollSnapshotDiff;
 
 class UKRollSettings;
+class UKRollBindingManifest;
 
+// Timings of the last successful fetch, per phase (milliseconds)
 USTRUCT(BlueprintType)
-struct FKRollSnapshotMeta
+struct FKRollFetchStats
 {
 	GENERATED_BODY()
 
+	// Body size as received (compressed size when the backend compressed it)
 	UPROPERTY(BlueprintReadOnly, Category="KRoll")
-	int32 SchemaVersion = 0;
+	int64 PayloadBytes = 0;
 
+	// Body size after decompression; equal to PayloadBytes for uncompressed responses
 	UPROPERTY(BlueprintReadOnly, Category="KRoll")
-	FString ActiveSnapshotId;
+	int64 UncompressedBytes = 0;
 
+	// Size of the compiled binary snapshot
 	UPROPERTY(BlueprintReadOnly, Category="KRoll")
-	FString ActiveSnapshotHash;
+	int64 SnapshotBytes = 0;
 
 	UPROPERTY(BlueprintReadOnly, Category="KRoll")
-	FDateTime PublishedAt;
+	int32 NumValues = 0;
 
+	// Keys added, removed or changed relative to the previous snapshot
 	UPROPERTY(BlueprintReadOnly, Category="KRoll")
-	FString Label;
+	int32 NumChangedKeys = 0;
 
-	bool IsValid() const
-	{
-		return SchemaVersion > 0 && !ActiveSnapshotId.IsEmpty();
-	}
+	// HTTP callback -> worker task start
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double QueueMs = 0.0;
+
+	// Compressed body -> bytes (worker)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double DecompressMs = 0.0;
+
+	// Bytes -> typed slots (worker)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double ParseMs = 0.0;
+
+	// Slots -> immutable snapshot (worker)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double BuildMs = 0.0;
+
+	// Key diff against the previous snapshot (worker)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double DiffMs = 0.0;
+
+	// Worker done -> game thread publish
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double DispatchMs = 0.0;
+
+	// Pointer swap (game thread)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double PublishMs = 0.0;
+
+	// OnConfigReady listeners (game thread)
+	UPROPERTY(BlueprintReadOnly, Category="KRoll")
+	double BroadcastMs = 0.0;
 };
 
 UCLASS()
@@ -45,48 +87,136 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// Starts a fetch, or joins the one already in flight
 	UFUNCTION(BlueprintCallable, Category="KRoll")
 	void FetchConfigs();
 
 	UFUNCTION(BlueprintPure, Category="KRoll")
-	bool IsReady() const { return bIsReady; }
+	bool IsFetchInFlight() const { return ActiveRequest.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	bool IsReady() const { return Store->IsPublished(); }
 
 	// Snapshot meta (optional but recommended to surface)
 	UFUNCTION(BlueprintPure, Category="KRoll")
-	bool HasSnapshotMeta() const { return bHasSnapshotMeta; }
+	bool HasSnapshotMeta() const;
 
 	UFUNCTION(BlueprintPure, Category="KRoll")
 	FKRollSnapshotMeta GetSnapshotMeta() const;
 
+	UFUNCTION(BlueprintPure, Category="KRoll")
+	FKRollFetchStats GetLastFetchStats() const { return LastFetchStats; }
+
 	bool GetBool(FName Key, bool& OutValue) const;
 	bool GetNumber(FName Key, double& OutValue) const;
+	bool GetInteger(FName Key, int64& OutValue) const;
 	bool GetString(FName Key, FString& OutValue) const;
 	TSharedPtr<FJsonValue> GetJson(FName Key) const;
 
+	// Handle overloads: the key is probed once per snapshot, then reads are array indexing
+	bool GetBool(const FKRollKeyHandle& Key, bool& OutValue) const;
+	bool GetNumber(const FKRollKeyHandle& Key, double& OutValue) const;
+	bool GetInteger(const FKRollKeyHandle& Key, int64& OutValue) const;
+	bool GetString(const FKRollKeyHandle& Key, FString& OutValue) const;
+	TSharedPtr<FJsonValue> GetJson(const FKRollKeyHandle& Key) const;
+
+	// Pins the current snapshot so several reads see one consistent version. Safe on any thread.
+	FKRollSnapshotPtr GetSnapshot() const { return Store->Pin(); }
+	const FKRollSnapshotStore& GetSnapshotStore() const { return *Store; }
+
+	// Strong reference for readers that may outlive this subsystem (see FKRollAPI)
+	FKRollSnapshotStoreRef GetSharedSnapshotStore() const { return Store; }
+
+	// Generation of the current snapshot; 0 before the first publish
+	uint32 GetSnapshotGeneration() const;
+
+	// Null when bindings are read from property metadata
+	const UKRollBindingManifest* GetBindingManifest() const { return BindingManifest; }
+
+	// Change notifications, batched and delivered from the subsystem tick once per frame.
+	// A prefix matches whole path segments ("characters.zombie" or "characters.zombie." -> "characters.zombie.*");
+	// empty matches all.
+	FDelegateHandle SubscribeKey(FName Key, FKRollKeysChangedDelegate Delegate);
+	FDelegateHandle SubscribePrefix(const FString& Prefix, FKRollKeysChangedDelegate Delegate);
+	void Unsubscribe(FDelegateHandle Handle);
+
+	// Fired on every publish, whether or not any value changed; for a snapshot loaded from disk
+	// during Initialize, on the first tick
 	UPROPERTY(BlueprintAssignable, Category="KRoll")
 	FKrollConfigReadyDelegate OnConfigReady;
 
+	// Every key that changed since the last frame, once per frame
+	UPROPERTY(BlueprintAssignable, Category="KRoll")
+	FKRollKeysChangedMulticast OnKeysChanged;
+
 private:
-	void OnFetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
+	// Automation tests drive the warm start and fetch outcomes without disk or network
+	friend struct FKRollSubsystemTestAccess;
+
+	void OnFetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, uint32 RequestId);
+	void LoadPersistedSnapshot();
+	void PublishPersistedSnapshot(const FKRollSnapshotPtr& Persisted);
+	bool IsCurrentSnapshotHash(const FString& Hash) const;
+	void PublishSnapshot(const FKRollSnapshotPtr& NewSnapshot, FKRollSnapshotDiff&& Diff, FKRollFetchStats Stats, uint32 RequestId, double BuiltAt);
+
+	void QueueChangedKeys(const FKRollSnapshotDiff& Diff);
+	void FlushChangedKeys();
+
+	bool Tick(float DeltaTime);
+
+	// The server confirmed the published snapshot (304 or matching ETag)
+	void KeepCurrentSnapshot(const TCHAR* Reason);
 
-	// Cache is keyed by dotted path: "characters.zombie.health"
-	mutable FRWLock CacheLock;
-	TMap<FName, TSharedPtr<FJsonValue>> Cache;
+	// Refresh scheduling (only when bAutoRefresh is set)
+	void ScheduleNextRefresh();
+	void ScheduleRetry(const FHttpResponsePtr& Response);
+
+	// Values + meta, keyed by dotted path: "characters.zombie.health".
+	// Slots are compiled (typed + coerced) when the snapshot is built, so reads never convert.
+	FKRollSnapshotStoreRef Store = MakeShared<FKRollSnapshotStore, ESPMode::ThreadSafe>();
+	FTSTicker::FDelegateHandle TickHandle;
 
-	bool bIsReady = false;
 	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> ActiveRequest;
 
-	// Snapshot meta is stored separately from values to avoid polluting the keyspace
-	mutable FRWLock MetaLock;
-	bool bHasSnapshotMeta = false;
-	FKRollSnapshotMeta SnapshotMeta;
+	// Snapshots are built on worker tasks; a late build of an older request never replaces a newer one
+	uint32 NextRequestId = 0;
+	uint32 LastPublishedRequestId = 0;
 
-	// Helpers
-	static bool ParseRootObject(const FString& JsonText, TSharedPtr<FJsonObject>& OutRoot);
+	// Set by Deinitialize. The object lives on until GC, so worker continuations that still
+	// resolve their weak pointer must not publish or broadcast through it.
+	bool bDeinitialized = false;
+
+	// A snapshot published before listeners could bind (the warm start), announced on the next tick
+	bool bConfigReadyPending = false;
+
+	FKRollFetchStats LastFetchStats;
+
+	UPROPERTY()
+	TObjectPtr<UKRollBindingManifest> BindingManifest;
+
+	void LoadBindingManifest();
 
-	static bool ParseSnapshotMeta(const TSharedPtr<FJsonObject>& RootObj, FKRollSnapshotMeta& OutMeta);
-	static bool BuildCacheFromEnvelope(const TSharedPtr<FJsonObject>& RootObj, TMap<FName, TSharedPtr<FJsonValue>>& OutCache);
+	// FPlatformTime::Seconds() of the next scheduled fetch; 0 when none is scheduled
+	double NextRefreshAt = 0.0;
+	int32 ConsecutiveFailures = 0;
+	FRandomStream RefreshRandom;
 
+	struct FKeySubscription
+	{
+		FDelegateHandle Handle;
+		FName Key;
+		FString Prefix;
+		bool bIsPrefix = false;
+		FKRollKeysChangedDelegate Delegate;
+
+		bool Matches(FName InKey, const FString& KeyString) const;
+	};
+	TArray<FKeySubscription> KeySubscriptions;
+
+	// Keys changed by publishes since the last flush
+	TSet<FName> PendingChangedKeys;
+
+	// Helpers
 	static void FlattenJsonObject(
 		const TSharedPtr<FJsonObject>& Obj,
 		const FString& Prefix,
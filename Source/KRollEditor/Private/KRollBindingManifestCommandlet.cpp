@@ -0,0 +1,16 @@
+#include "KRollBindingManifestCommandlet.h"
+#include "KRollBindingManifestExport.h"
+
+UKRollBindingManifestCommandlet::UKRollBindingManifestCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UKRollBindingManifestCommandlet::Main(const FString& Params)
+{
+	FString PackageName;
+	return FKRollBindingManifestExport::Run(PackageName) ? 0 : 1;
+}
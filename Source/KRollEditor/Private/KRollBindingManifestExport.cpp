@@ -0,0 +1,60 @@
+#include "KRollBindingManifestExport.h"
+
+#include "KRollBindingManifest.h"
+#include "KRollSettings.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY(LogKRollEditor);
+
+bool FKRollBindingManifestExport::Run(FString& OutPackageName)
+{
+	const UKRollSettings* Settings = GetDefault<UKRollSettings>();
+	const FSoftObjectPath& AssetPath = Settings->BindingManifest;
+	if (AssetPath.IsNull())
+	{
+		UE_LOG(LogKRollEditor, Warning, TEXT("KRoll: no binding manifest path configured; cooked builds will not apply property bindings"));
+		return false;
+	}
+
+	OutPackageName = AssetPath.GetLongPackageName();
+
+	UKRollBindingManifest* Manifest = Cast<UKRollBindingManifest>(AssetPath.TryLoad());
+	const bool bCreated = Manifest == nullptr;
+	if (bCreated)
+	{
+		UPackage* NewPackage = CreatePackage(*OutPackageName);
+		Manifest = NewObject<UKRollBindingManifest>(NewPackage, *AssetPath.GetAssetName(), RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Manifest);
+	}
+
+	// Unchanged manifests are left alone so cooks do not touch the file under source control
+	if (!Manifest->Rebuild() && !bCreated)
+	{
+		UE_LOG(LogKRollEditor, Log, TEXT("KRoll: binding manifest %s is up to date (%d classes)"), *OutPackageName, Manifest->NumClasses());
+		return true;
+	}
+
+	UPackage* Package = Manifest->GetPackage();
+	Package->MarkPackageDirty();
+
+	const FString Filename = FPackageName::LongPackageNameToFilename(OutPackageName, FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+	if (!UPackage::SavePackage(Package, Manifest, *Filename, SaveArgs))
+	{
+		// A read-only (checked-in) manifest still beats none: cook the copy on disk if there is one
+		const bool bExists = FPackageName::DoesPackageExist(OutPackageName);
+		UE_LOG(LogKRollEditor, Error, TEXT("KRoll: failed to save binding manifest %s%s"), *Filename,
+			bExists ? TEXT("; cooking the previous version") : TEXT(""));
+		return bExists;
+	}
+
+	UE_LOG(LogKRollEditor, Display, TEXT("KRoll: wrote binding manifest %s (%d classes)"), *Filename, Manifest->NumClasses());
+	return true;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogKRollEditor, Log, All);
+
+/**
+	* Rescans property metadata into the manifest asset named by UKRollSettings::BindingManifest,
+	* creating it if needed. The package is only re-saved when its contents change.
+	*/
+class FKRollBindingManifestExport
+{
+public:
+	// True if a manifest package exists to cook. A failed save still returns true when an older
+	// version of the package is on disk; false if no path is configured or nothing was ever saved.
+	static bool Run(FString& OutPackageName);
+};
@@ -0,0 +1,28 @@
+#include "KRollEditor.h"
+#include "KRollBindingManifestExport.h"
+
+#include "GameDelegates.h"
+#include "Modules/ModuleManager.h"
+
+void FKRollEditorModule::StartupModule()
+{
+	ModifyCookHandle = FGameDelegates::Get().GetModifyCookDelegate().AddRaw(this, &FKRollEditorModule::ModifyCook);
+}
+
+void FKRollEditorModule::ShutdownModule()
+{
+	FGameDelegates::Get().GetModifyCookDelegate().Remove(ModifyCookHandle);
+	ModifyCookHandle.Reset();
+}
+
+void FKRollEditorModule::ModifyCook(TArray<FName>& PackagesToCook, TArray<FName>& PackagesToNeverCook)
+{
+	// Only referenced from config, so the cooker would not find it on its own
+	FString PackageName;
+	if (FKRollBindingManifestExport::Run(PackageName))
+	{
+		PackagesToCook.AddUnique(FName(*PackageName));
+	}
+}
+
+IMPLEMENT_MODULE(FKRollEditorModule, KRollEditor)
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "KRollBindingManifestCommandlet.generated.h"
+
+/**
+	* Regenerates the KRoll binding manifest from property metadata, for build pipelines that want it
+	* committed or checked ahead of a cook:
+	*
+	*   UnrealEditor-Cmd <Project>.uproject -run=KRollBindingManifest
+	*/
+UCLASS()
+class UKRollBindingManifestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UKRollBindingManifestCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
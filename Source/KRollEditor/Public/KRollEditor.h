@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+class FKRollEditorModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	// Regenerates the binding manifest at the start of a cook and adds it to the cooked packages
+	void ModifyCook(TArray<FName>& PackagesToCook, TArray<FName>& PackagesToNeverCook);
+
+	FDelegateHandle ModifyCookHandle;
+};
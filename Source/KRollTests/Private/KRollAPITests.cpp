@@ -0,0 +1,60 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "KRollAPI.h"
+
+namespace
+{
+// Not expected in any real config, so reads outside a test scope return the default
+const TCHAR* ScopedKey = TEXT("tests.api.scoped_value");
+
+FKRollSnapshotStoreRef MakeStore(double Value)
+{
+	FKRollSnapshotStoreRef Store = MakeShared<FKRollSnapshotStore, ESPMode::ThreadSafe>();
+	Store->Publish(KRollTests::MakeSnapshot(FString::Printf(TEXT("{\"%s\": %g}"), ScopedKey, Value)));
+	return Store;
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollAPIScopedInstanceTest, "KRoll.API.ScopedInstance", KROLL_TEST_FLAGS)
+
+bool FKRollAPIScopedInstanceTest::RunTest(const FString& Parameters)
+{
+	const FKRollSnapshotStoreRef Outer = MakeStore(1.0);
+	const FKRollSnapshotStoreRef Inner = MakeStore(2.0);
+
+	TestEqual(TEXT("No scope: registered instance (or default)"), FKRollAPI::GetNumber(ScopedKey, -1.0), -1.0);
+	{
+		FKRollAPI::FScopedInstance OuterScope(Outer);
+		TestEqual(TEXT("Scoped store is read"), FKRollAPI::GetNumber(ScopedKey, -1.0), 1.0);
+		{
+			FKRollAPI::FScopedInstance InnerScope(Inner);
+			TestEqual(TEXT("Innermost scope wins"), FKRollAPI::GetNumber(ScopedKey, -1.0), 2.0);
+
+			const FKRollKeyHandle Handle{FName(ScopedKey)};
+			TestEqual(TEXT("Handle reads go through the scope"), FKRollAPI::GetNumber(Handle, -1.0), 2.0);
+		}
+		TestEqual(TEXT("Leaving a scope restores the previous store"), FKRollAPI::GetNumber(ScopedKey, -1.0), 1.0);
+
+		// The binding is per thread
+		const double OtherThread = Async(EAsyncExecution::ThreadPool, []()
+		{
+			return FKRollAPI::GetNumber(ScopedKey, -1.0);
+		}).Get();
+		TestEqual(TEXT("Other threads are not bound by this scope"), OtherThread, -1.0);
+	}
+	TestEqual(TEXT("Leaving the last scope restores the default"), FKRollAPI::GetNumber(ScopedKey, -1.0), -1.0);
+
+	UKRollSubsystem* Instance = KRollTests::MakeSubsystem(KRollTests::MakeSnapshot(FString::Printf(TEXT("{\"%s\": 3}"), ScopedKey)));
+	{
+		FKRollAPI::FScopedInstance InstanceScope(Instance);
+		TestTrue(TEXT("Scoped instance is resolved"), FKRollAPI::Resolve() == Instance);
+		TestEqual(TEXT("Scoped instance's store is read"), FKRollAPI::GetNumber(ScopedKey, -1.0), 3.0);
+	}
+	TestTrue(TEXT("Scoped instance is released"), FKRollAPI::Resolve() != Instance);
+	return true;
+}
+
+#endif
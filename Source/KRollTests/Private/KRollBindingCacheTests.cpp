@@ -0,0 +1,63 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_METADATA
+
+#include "KRollBindingCache.h"
+#include "KRollTestTypes.h"
+
+#include "UObject/UObjectIterator.h"
+
+// Targets gathered early in a pass keep pointers into the cache while later targets add classes
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollBindingCacheGrowthTest, "KRoll.Bindings.CacheGrowth", KROLL_TEST_FLAGS)
+
+bool FKRollBindingCacheGrowthTest::RunTest(const FString& Parameters)
+{
+	UKRollSubsystem* KRoll = KRollTests::MakeSubsystem(KRollTests::MakeSnapshot(TEXT("{\"tests.krolltestactor.speed\": 1}")));
+
+	FKRollBindingCache Cache;
+	const FKRollClassBindings& Bindings = Cache.GetOrBuildActorBindings(AKRollTestActor::StaticClass());
+	const TArray<FKRollPropertyBinding>& SetBindings = Cache.GetOrBuildAttributeSetBindings(UKRollTestAttributeSet::StaticClass());
+	const int32 NumBindings = Bindings.ActorBindings.Num();
+	const int32 NumSetBindings = SetBindings.Num();
+	const FKRollPropertyBinding* FirstBinding = Bindings.ActorBindings.GetData();
+
+	AKRollTestActor* Actor = NewObject<AKRollTestActor>(GetTransientPackage());
+	const FKRollBindingPlan& Plan = Cache.GetOrBuildPlan(Bindings.ActorBindings, Actor, Actor, KRoll);
+
+	// Enough classes to force both maps to rehash several times
+	int32 NumInserted = 0;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+		if (Class->IsChildOf(AActor::StaticClass()))
+		{
+			Cache.GetOrBuildActorBindings(Class);
+			++NumInserted;
+		}
+		else if (Class->IsChildOf(UAttributeSet::StaticClass()))
+		{
+			Cache.GetOrBuildAttributeSetBindings(Class);
+			++NumInserted;
+		}
+	}
+	AddInfo(FString::Printf(TEXT("Inserted %d classes"), NumInserted));
+
+	TestTrue(TEXT("Actor bindings did not move"), &Cache.GetOrBuildActorBindings(AKRollTestActor::StaticClass()) == &Bindings);
+	TestTrue(TEXT("Attribute set bindings did not move"), &Cache.GetOrBuildAttributeSetBindings(UKRollTestAttributeSet::StaticClass()) == &SetBindings);
+	TestEqual(TEXT("Actor bindings are intact"), Bindings.ActorBindings.Num(), NumBindings);
+	TestTrue(TEXT("Actor binding storage is intact"), Bindings.ActorBindings.GetData() == FirstBinding);
+	TestEqual(TEXT("Attribute set bindings are intact"), SetBindings.Num(), NumSetBindings);
+	TestTrue(TEXT("Plan is still served for the target"), &Cache.GetOrBuildPlan(Bindings.ActorBindings, Actor, Actor, KRoll) == &Plan);
+
+	// Pruning only drops classes that are gone
+	Cache.PruneStaleClasses();
+	TestTrue(TEXT("Live bindings survive a prune"), &Cache.GetOrBuildActorBindings(AKRollTestActor::StaticClass()) == &Bindings);
+	TestTrue(TEXT("Live plans survive a prune"), &Cache.GetOrBuildPlan(Bindings.ActorBindings, Actor, Actor, KRoll) == &Plan);
+	return true;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KRollBindingApplier.h"
+#include "KRollBindingCache.h"
+#include "KRollKeyResolver.h"
+#include "KRollTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollKeyTemplateTest, "KRoll.Bindings.KeyTemplates", KROLL_TEST_FLAGS)
+
+bool FKRollKeyTemplateTest::RunTest(const FString& Parameters)
+{
+	const FKRollKeyTemplate Plain = FKRollKeyTemplate::Compile(TEXT("characters.zombie.health"));
+	TestTrue(TEXT("Plain key compiles"), Plain.IsValid());
+	TestFalse(TEXT("Plain key has no tokens"), Plain.HasTokens());
+
+	const FKRollKeyTemplate Templated = FKRollKeyTemplate::Compile(TEXT("characters.{Class}.{archetype}.health"));
+	TestTrue(TEXT("Token names are case-insensitive"), Templated.IsValid());
+	TestTrue(TEXT("Uses {class}"), Templated.Uses(EKRollKeyToken::Class));
+	TestTrue(TEXT("Uses {archetype}"), Templated.Uses(EKRollKeyToken::Archetype));
+	TestFalse(TEXT("Does not use {level}"), Templated.Uses(EKRollKeyToken::Level));
+
+	FString Error;
+	TestFalse(TEXT("Unknown token is rejected"), FKRollKeyTemplate::Compile(TEXT("a.{bogus}"), &Error).IsValid());
+	TestFalse(TEXT("Unclosed brace is rejected"), FKRollKeyTemplate::Compile(TEXT("a.{class"), &Error).IsValid());
+	TestFalse(TEXT("Stray closing brace is rejected"), FKRollKeyTemplate::Compile(TEXT("a.}"), &Error).IsValid());
+	TestFalse(TEXT("Empty key is rejected"), FKRollKeyTemplate::Compile(FString(), &Error).IsValid());
+
+	const AKRollTestActor* Actor = NewObject<AKRollTestActor>(GetTransientPackage());
+
+	const FName ClassKey = FKRollKeyResolver::ResolveKey(FKRollKeyTemplate::Compile(TEXT("tests.{class}.speed")), Actor, Actor);
+	TestEqual(TEXT("{class} is the normalized class name"), ClassKey.ToString(), FString(TEXT("tests.krolltestactor.speed")));
+
+	const FName ArchetypeKey = FKRollKeyResolver::ResolveKey(FKRollKeyTemplate::Compile(TEXT("tests.{archetype}")), Actor, Actor);
+	TestEqual(TEXT("{archetype} falls back to the class without KRollArchetype"), ArchetypeKey.ToString(), FString(TEXT("tests.krolltestactor")));
+
+	TestTrue(TEXT("{level} has no value outside a level"),
+		FKRollKeyResolver::ResolveKey(FKRollKeyTemplate::Compile(TEXT("tests.{level}")), Actor, Actor).IsNone());
+	TestTrue(TEXT("{component} has no value for an actor"),
+		FKRollKeyResolver::ResolveKey(FKRollKeyTemplate::Compile(TEXT("tests.{component}")), Actor, Actor).IsNone());
+
+	const FName PlainKey = FKRollKeyResolver::ResolveKey(Plain, Actor, Actor);
+	TestEqual(TEXT("Plain keys resolve to themselves"), PlainKey.ToString(), FString(TEXT("characters.zombie.health")));
+	return true;
+}
+
+#if WITH_METADATA
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollPlanCachingTest, "KRoll.Bindings.PlanCaching", KROLL_TEST_FLAGS)
+
+bool FKRollPlanCachingTest::RunTest(const FString& Parameters)
+{
+	const FKRollSnapshotPtr First = KRollTests::MakeSnapshot(TEXT("{\"tests.krolltestactor.speed\": 3.5, \"tests.fixed.count\": 2}"));
+	if (!TestTrue(TEXT("Snapshot builds"), First.IsValid()))
+	{
+		return false;
+	}
+	UKRollSubsystem* KRoll = KRollTests::MakeSubsystem(First);
+
+	FKRollBindingCache Cache;
+	const FKRollClassBindings& Bindings = Cache.GetOrBuildActorBindings(AKRollTestActor::StaticClass());
+	TestTrue(TEXT("Test actor has actor bindings"), Bindings.bHasActorBindings);
+
+	AKRollTestActor* A = NewObject<AKRollTestActor>(GetTransientPackage());
+	AKRollTestActor* B = NewObject<AKRollTestActor>(GetTransientPackage());
+
+	const FKRollBindingPlan& PlanA = Cache.GetOrBuildPlan(Bindings.ActorBindings, A, A, KRoll);
+	const FKRollBindingPlan& PlanB = Cache.GetOrBuildPlan(Bindings.ActorBindings, B, B, KRoll);
+	TestTrue(TEXT("Targets of one class and archetype share a plan"), &PlanA == &PlanB);
+	TestEqual(TEXT("Plan is built for the current generation"), PlanA.Generation, KRoll->GetSnapshotGeneration());
+	TestTrue(TEXT("Plan entries hold resolved keys"), PlanA.Entries.ContainsByPredicate([](const FKRollPlanEntry& It)
+	{
+		return It.Key == FName(TEXT("tests.krolltestactor.speed"));
+	}));
+
+	FKRollBindingApplier::ApplyPlan(A, PlanA);
+	TestEqual(TEXT("Templated key is applied"), A->Speed, 3.5f);
+	TestEqual(TEXT("Static key is applied"), A->Count, 2);
+
+	// A new snapshot rebuilds the same plan in place
+	KRoll->GetSharedSnapshotStore()->Publish(KRollTests::MakeSnapshot(TEXT("{\"tests.krolltestactor.speed\": 4}"), TEXT("test2")));
+
+	const FKRollBindingPlan& Rebuilt = Cache.GetOrBuildPlan(Bindings.ActorBindings, A, A, KRoll);
+	TestTrue(TEXT("Plan is rebuilt in place"), &Rebuilt == &PlanA);
+	TestEqual(TEXT("Rebuilt plan has the new generation"), Rebuilt.Generation, KRoll->GetSnapshotGeneration());
+
+	FKRollBindingApplier::ApplyPlan(A, Rebuilt);
+	TestEqual(TEXT("New value is applied"), A->Speed, 4.f);
+	TestEqual(TEXT("Missing key falls back to KRollDefault"), A->Count, 7);
+
+	// Same key context, other list kind: attribute set plans never alias actor plans
+	UKRollTestAttributeSet* Set = NewObject<UKRollTestAttributeSet>(A);
+	const TArray<FKRollPropertyBinding>& SetBindings = Cache.GetOrBuildAttributeSetBindings(UKRollTestAttributeSet::StaticClass());
+	const FKRollBindingPlan& SetPlan = Cache.GetOrBuildPlan(SetBindings, Set, A, KRoll);
+	TestTrue(TEXT("Attribute set plan is separate from the actor plan"), &SetPlan != &Rebuilt);
+	return true;
+}
+#endif
+
+#endif
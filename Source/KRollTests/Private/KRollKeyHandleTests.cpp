@@ -0,0 +1,88 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KRollKeyHandle.h"
+
+// FNV-1a 64 reference vectors; keys are lowercased before hashing
+static_assert(FKRollKeyHash::Compute("", 0) == FKRollKeyHash::Offset, "Empty key hashes to the FNV offset basis");
+static_assert(FKRollKeyHash::Compute("a", 1) == 0xaf63dc4c8601ec8cull, "FNV-1a of \"a\"");
+static_assert(FKRollKeyHash::Compute("foobar", 6) == 0x85944171f73967e8ull, "FNV-1a of \"foobar\"");
+static_assert(FKRollKeyHash::Compute("FooBar", 6) == FKRollKeyHash::Compute("foobar", 6), "Hash is case-insensitive");
+
+namespace
+{
+const FKRollKeyHandle& HealthKey()
+{
+	return KROLL_KEY("Tests.Keys.Health");
+}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollKeyHashTest, "KRoll.Keys.Hash", KROLL_TEST_FLAGS)
+
+bool FKRollKeyHashTest::RunTest(const FString& Parameters)
+{
+	constexpr uint64 CompileTime = FKRollKeyHash::Compute("characters.zombie.health", 24);
+	TestEqual(TEXT("Compile-time and runtime hashes agree"), FKRollKeyHash::Compute(FUtf8StringView(UTF8TEXTVIEW("characters.zombie.health"))), CompileTime);
+	TestEqual(TEXT("Wide and UTF-8 keys hash alike"), FKRollKeyHash::Compute(TEXT("characters.zombie.health"), 24), CompileTime);
+
+	// Enough keys for probe chains in the blob's hash table
+	FString Values = TEXT("{");
+	for (int32 Idx = 0; Idx < 200; ++Idx)
+	{
+		Values += FString::Printf(TEXT("%s\"tests.keys.k%d\": %d"), Idx ? TEXT(", ") : TEXT(""), Idx, Idx);
+	}
+	Values += TEXT("}");
+	const FKRollSnapshotPtr Snapshot = KRollTests::MakeSnapshot(Values);
+	if (!TestTrue(TEXT("Snapshot builds"), Snapshot.IsValid()))
+	{
+		return false;
+	}
+
+	for (int32 Idx = 0; Idx < 200; ++Idx)
+	{
+		const FString Key = FString::Printf(TEXT("tests.keys.k%d"), Idx);
+		const FTCHARToUTF8 Utf8(*Key.ToUpper());
+		const int32 ByName = Snapshot->FindIndex(FName(*Key));
+		if (ByName == INDEX_NONE || Snapshot->FindIndex(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length())) != ByName)
+		{
+			AddError(FString::Printf(TEXT("Hash lookup of %s disagrees with the name index"), *Key));
+		}
+	}
+	TestEqual(TEXT("Missing key is not found"), Snapshot->FindIndex(FUtf8StringView(UTF8TEXTVIEW("tests.keys.missing"))), int32(INDEX_NONE));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollKeyHandleTest, "KRoll.Keys.Handle", KROLL_TEST_FLAGS)
+
+bool FKRollKeyHandleTest::RunTest(const FString& Parameters)
+{
+	TestTrue(TEXT("KROLL_KEY yields one handle per use site"), &HealthKey() == &HealthKey());
+	TestTrue(TEXT("Literal handle names its key"), HealthKey().GetKey() == FName(TEXT("tests.keys.health")));
+
+	const FKRollSnapshotPtr First = KRollTests::MakeSnapshot(TEXT("{\"tests.keys.other\": 1, \"tests.keys.health\": 100}"));
+	const FKRollSnapshotPtr Second = KRollTests::MakeSnapshot(TEXT("{\"tests.keys.health\": 50}"), TEXT("test2"));
+	const FKRollSnapshotPtr Empty = KRollTests::MakeSnapshot(TEXT("{}"), TEXT("test3"));
+	if (!TestTrue(TEXT("Snapshots build"), First.IsValid() && Second.IsValid() && Empty.IsValid()))
+	{
+		return false;
+	}
+
+	const FKRollKeyHandle ByName(FName(TEXT("tests.keys.health")));
+	const int32 Slot = HealthKey().Resolve(*First);
+	TestTrue(TEXT("Literal handle resolves case-insensitively"), Slot != INDEX_NONE);
+	TestEqual(TEXT("Literal handle matches the name index"), Slot, First->FindIndex(FName(TEXT("tests.keys.health"))));
+	TestEqual(TEXT("Name handle matches the name index"), ByName.Resolve(*First), Slot);
+	TestEqual(TEXT("Cached resolve is stable"), HealthKey().Resolve(*First), Slot);
+
+	// A handle follows whichever snapshot it is read against
+	TestEqual(TEXT("Handle re-resolves against a new snapshot"), HealthKey().Resolve(*Second), Second->FindIndex(FName(TEXT("tests.keys.health"))));
+	TestEqual(TEXT("Missing key resolves to INDEX_NONE"), HealthKey().Resolve(*Empty), int32(INDEX_NONE));
+	TestEqual(TEXT("Switching back resolves again"), HealthKey().Resolve(*First), Slot);
+
+	double Value = 0.0;
+	TestTrue(TEXT("Resolved slot reads the value"), Second->TryGetNumber(HealthKey().Resolve(*Second), Value) && Value == 50.0);
+	return true;
+}
+
+#endif
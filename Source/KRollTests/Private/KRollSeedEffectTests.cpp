@@ -0,0 +1,74 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_METADATA
+
+#include "GameplayEffect.h"
+#include "KRollBindingCache.h"
+#include "KRollTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollSeedEffectTest, "KRoll.Bindings.SeedEffect", KROLL_TEST_FLAGS)
+
+bool FKRollSeedEffectTest::RunTest(const FString& Parameters)
+{
+	// Distinct values, so a modifier paired with the wrong attribute shows up
+	UKRollSubsystem* KRoll = KRollTests::MakeSubsystem(KRollTests::MakeSnapshot(
+		TEXT("{\"tests.krolltestactor.health\": 100, \"tests.krolltestactor.stamina\": 25}")));
+
+	FKRollBindingCache Cache;
+	AKRollTestActor* Actor = NewObject<AKRollTestActor>(GetTransientPackage());
+	UKRollTestAttributeSet* Set = NewObject<UKRollTestAttributeSet>(Actor);
+	const TArray<FKRollPropertyBinding>& Bindings = Cache.GetOrBuildAttributeSetBindings(UKRollTestAttributeSet::StaticClass());
+	const FKRollBindingPlan& Plan = Cache.GetOrBuildPlan(Bindings, Set, Actor, KRoll);
+
+	const UGameplayEffect* Effect = Cache.GetOrBuildSeedEffect(Plan);
+	if (!TestNotNull(TEXT("Plan with attribute values has a seed effect"), Effect))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Seed effect is instant"), Effect->DurationPolicy == EGameplayEffectDurationType::Instant);
+	TestEqual(TEXT("One modifier per attribute"), Effect->Modifiers.Num(), 2);
+
+	const TPair<FName, float> Expected[] = {
+		{ GET_MEMBER_NAME_CHECKED(UKRollTestAttributeSet, Health), 100.f },
+		{ GET_MEMBER_NAME_CHECKED(UKRollTestAttributeSet, Stamina), 25.f },
+	};
+	for (const TPair<FName, float>& It : Expected)
+	{
+		const FGameplayAttribute Attribute(FindFProperty<FProperty>(UKRollTestAttributeSet::StaticClass(), It.Key));
+		const FGameplayModifierInfo* Modifier = Effect->Modifiers.FindByPredicate([&Attribute](const FGameplayModifierInfo& Info)
+		{
+			return Info.Attribute == Attribute;
+		});
+		if (!TestNotNull(*FString::Printf(TEXT("Modifier for %s"), *It.Key.ToString()), Modifier))
+		{
+			continue;
+		}
+
+		float Magnitude = 0.f;
+		TestTrue(TEXT("Modifier overrides"), Modifier->ModifierOp == EGameplayModOp::Override);
+		TestTrue(TEXT("Magnitude is static"), Modifier->ModifierMagnitude.GetStaticMagnitudeIfPossible(1.f, Magnitude));
+		TestEqual(*FString::Printf(TEXT("%s is seeded with its own value"), *It.Key.ToString()), Magnitude, It.Value);
+	}
+
+	TestTrue(TEXT("Effect is cached for the generation"), Cache.GetOrBuildSeedEffect(Plan) == Effect);
+
+	// A live update seeds only the changed attributes, with one effect shared by every ASC changing them
+	if (TestEqual(TEXT("Plan has one entry per attribute"), Plan.Entries.Num(), 2))
+	{
+		const FKRollPlanEntry Forward[] = { Plan.Entries[0], Plan.Entries[1] };
+		const FKRollPlanEntry Reverse[] = { Plan.Entries[1], Plan.Entries[0] };
+		const UGameplayEffect* Update = Cache.GetOrBuildUpdateSeedEffect(Forward, KRoll);
+		TestTrue(TEXT("Update effect is shared whatever the order"), Update && Cache.GetOrBuildUpdateSeedEffect(Reverse, KRoll) == Update);
+
+		const UGameplayEffect* Single = Cache.GetOrBuildUpdateSeedEffect(MakeArrayView(&Plan.Entries[0], 1), KRoll);
+		TestTrue(TEXT("Update effect covers only the changed attribute"), Single && Single->Modifiers.Num() == 1);
+	}
+
+	// The plan is rebuilt for a snapshot without the keys; so is its effect
+	KRoll->GetSharedSnapshotStore()->Publish(KRollTests::MakeSnapshot(TEXT("{}"), TEXT("test2")));
+	const FKRollBindingPlan& Rebuilt = Cache.GetOrBuildPlan(Bindings, Set, Actor, KRoll);
+	TestNull(TEXT("Plan without attribute values seeds nothing"), Cache.GetOrBuildSeedEffect(Rebuilt));
+	return true;
+}
+
+#endif
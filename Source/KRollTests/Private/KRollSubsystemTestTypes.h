@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "KRollSubsystemTestTypes.generated.h"
+
+// Counts OnConfigReady broadcasts, which only a UFUNCTION can listen to
+UCLASS(Transient, HideDropdown)
+class UKRollConfigReadyCounter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 NumBroadcasts = 0;
+
+	UFUNCTION()
+	void HandleConfigReady() { ++NumBroadcasts; }
+};
@@ -0,0 +1,38 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KRollSubsystemTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollWarmStartTest, "KRoll.Subsystem.WarmStart", KROLL_TEST_FLAGS)
+
+bool FKRollWarmStartTest::RunTest(const FString& Parameters)
+{
+	const FKRollSnapshotPtr Persisted = KRollTests::MakeSnapshot(TEXT("{\"tests.warm.value\": 1}"));
+	if (!TestTrue(TEXT("Snapshot builds"), Persisted.IsValid()))
+	{
+		return false;
+	}
+
+	// Initialize publishes the disk snapshot before any listener can bind
+	UKRollSubsystem* KRoll = KRollTests::MakeSubsystem(nullptr);
+	FKRollSubsystemTestAccess::WarmStart(*KRoll, Persisted);
+	TestTrue(TEXT("Ready from disk"), KRoll->IsReady());
+
+	UKRollConfigReadyCounter* Listener = NewObject<UKRollConfigReadyCounter>(GetTransientPackage());
+	KRoll->OnConfigReady.AddDynamic(Listener, &UKRollConfigReadyCounter::HandleConfigReady);
+
+	// The first fetch confirms the disk snapshot, so nothing is published again
+	FKRollSubsystemTestAccess::NotModified(*KRoll);
+	TestEqual(TEXT("Not announced before the first tick"), Listener->NumBroadcasts, 0);
+	TestTrue(TEXT("The disk snapshot is kept"), KRoll->GetSnapshot() == Persisted);
+
+	FKRollSubsystemTestAccess::Tick(*KRoll);
+	TestEqual(TEXT("Warm start is announced on the first tick"), Listener->NumBroadcasts, 1);
+
+	FKRollSubsystemTestAccess::Tick(*KRoll);
+	TestEqual(TEXT("Warm start is announced once"), Listener->NumBroadcasts, 1);
+	return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KRollSnapshot.h"
+#include "KRollSnapshotParser.h"
+#include "KRollSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "UObject/Package.h"
+
+#if UE_VERSION_NEWER_THAN_OR_EQUAL(5, 5, 0)
+#define KROLL_TEST_FLAGS (EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#else
+#define KROLL_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+namespace KRollTests
+{
+// Builds a snapshot from the JSON object that would be the "values" member of a fetch response
+inline FKRollSnapshotPtr MakeSnapshot(const FString& ValuesJson, const FString& Hash = TEXT("test"))
+{
+	const FString Body = FString::Printf(
+		TEXT("{\"meta\":{\"schema_version\":1,\"active_snapshot_id\":\"test\",\"active_snapshot_hash\":\"%s\"},\"values\":%s}"),
+		*Hash, *ValuesJson);
+
+	const FTCHARToUTF8 Utf8(*Body, Body.Len());
+	FKRollSnapshotParser::FResult Parsed;
+	if (!FKRollSnapshotParser::Parse(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()), /*bAllowTypeCoercion*/ true, Parsed))
+	{
+		return nullptr;
+	}
+	return FKRollSnapshot::Build(MoveTemp(Parsed.Values), Parsed.bHasMeta ? &Parsed.Meta : nullptr, /*bAllowTypeCoercion*/ true);
+}
+
+// A subsystem that is never initialised (no fetches, not registered with FKRollAPI) serving Snapshot
+inline UKRollSubsystem* MakeSubsystem(const FKRollSnapshotPtr& Snapshot)
+{
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+	UKRollSubsystem* Subsystem = NewObject<UKRollSubsystem>(GameInstance);
+	if (Snapshot.IsValid())
+	{
+		Subsystem->GetSharedSnapshotStore()->Publish(Snapshot);
+	}
+	return Subsystem;
+}
+}
+
+// Drives the UKRollSubsystem paths that need disk or network in a real run (a friend of the subsystem)
+struct FKRollSubsystemTestAccess
+{
+	// What Initialize does with a valid snapshot file
+	static void WarmStart(UKRollSubsystem& Subsystem, const FKRollSnapshotPtr& Persisted) { Subsystem.PublishPersistedSnapshot(Persisted); }
+
+	// What a 304 response does
+	static void NotModified(UKRollSubsystem& Subsystem) { Subsystem.KeepCurrentSnapshot(TEXT("not modified")); }
+
+	static void Tick(UKRollSubsystem& Subsystem) { Subsystem.Tick(0.f); }
+};
+
+#endif
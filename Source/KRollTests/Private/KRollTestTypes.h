@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AttributeSet.h"
+#include "KRollTestTypes.generated.h"
+
+// Fixtures for the KRoll automation tests; bound from property metadata, so only usable WITH_METADATA
+
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class AKRollTestActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta=(KRollKey="tests.{class}.speed"))
+	float Speed = 0.f;
+
+	UPROPERTY(meta=(KRollKey="tests.fixed.count", KRollDefault="7"))
+	int32 Count = 0;
+};
+
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class UKRollTestAttributeSet : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta=(KRollKey="tests.{archetype}.health"))
+	FGameplayAttributeData Health;
+
+	UPROPERTY(meta=(KRollKey="tests.{archetype}.stamina"))
+	FGameplayAttributeData Stamina;
+};
@@ -0,0 +1,4 @@
+#include "Modules/ModuleManager.h"
+
+// Automation tests and their fixtures; an editor module, so none of it ships or gets cooked
+IMPLEMENT_MODULE(FDefaultModuleImpl, KRollTests)
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "KRollValueKindTestTypes.generated.h"
+
+// One property per supported value kind, for the value kind tests; bound from property metadata
+
+UENUM()
+enum class EKRollTestMode : uint8
+{
+	Slow,
+	Fast,
+	Turbo
+};
+
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class AKRollValueKindTestActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(meta=(KRollKey="tests.kinds.speed"))
+	float Speed = 0.f;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.flag"))
+	bool bFlag = false;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.count", KRollDefault="7"))
+	int32 Count = 0;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.big"))
+	int64 Big = 0;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.ratio", KRollScale="2", KRollClampMax="10"))
+	double Ratio = 0.0;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.mode", KRollDefault="Fast"))
+	EKRollTestMode Mode = EKRollTestMode::Slow;
+
+	// Not an enumerator: the default must be dropped, not read as Slow (0)
+	UPROPERTY(meta=(KRollKey="tests.kinds.bad_mode", KRollDefault="NotAnEnumerator"))
+	EKRollTestMode BadMode = EKRollTestMode::Turbo;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.tag"))
+	FName Tag;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.label"))
+	FString Label;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.offset"))
+	FVector Offset = FVector::ZeroVector;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.tint", KRollScale="0.5"))
+	FLinearColor Tint = FLinearColor::Black;
+
+	UPROPERTY(meta=(KRollKey="tests.kinds.curve"))
+	TArray<float> Curve;
+};
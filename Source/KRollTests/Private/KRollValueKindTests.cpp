@@ -0,0 +1,101 @@
+#include "KRollTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KRollBindingApplier.h"
+#include "KRollBindingCache.h"
+#include "KRollValueKindTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollCompileDefaultTest, "KRoll.Bindings.CompileDefault", KROLL_TEST_FLAGS)
+
+bool FKRollCompileDefaultTest::RunTest(const FString& Parameters)
+{
+	auto Compile = [](EKRollValueKind Kind, const TCHAR* Text, const UEnum* Enum = nullptr)
+	{
+		FKRollPropertyBinding Binding;
+		Binding.Kind = Kind;
+		Binding.Enum = Enum;
+		Binding.Transform.DefaultText = FString(Text);
+		FKRollBindingApplier::CompileDefault(Binding);
+		return Binding.Transform;
+	};
+
+	const FKRollTransform Int = Compile(EKRollValueKind::Int32, TEXT(" 12 "));
+	TestTrue(TEXT("Numeric default is parsed"), Int.DefaultValue.IsSet() && *Int.DefaultValue == 12.0);
+	const FKRollTransform BadInt = Compile(EKRollValueKind::Int32, TEXT("twelve"));
+	TestFalse(TEXT("Non-numeric default is dropped"), BadInt.DefaultValue.IsSet() || BadInt.DefaultText.IsSet());
+
+	const FKRollTransform Bool = Compile(EKRollValueKind::Bool, TEXT("TRUE"));
+	TestTrue(TEXT("Bool default accepts true/false"), Bool.DefaultValue.IsSet() && *Bool.DefaultValue == 1.0);
+	TestFalse(TEXT("Bool default rejects other words"), Compile(EKRollValueKind::Bool, TEXT("yes")).DefaultValue.IsSet());
+
+	const UEnum* Enum = StaticEnum<EKRollTestMode>();
+	const FKRollTransform Named = Compile(EKRollValueKind::Enum, TEXT("Turbo"), Enum);
+	TestTrue(TEXT("Enum default resolves a short name"), Named.DefaultValue.IsSet() && *Named.DefaultValue == double(EKRollTestMode::Turbo));
+	const FKRollTransform Qualified = Compile(EKRollValueKind::Enum, TEXT("EKRollTestMode::Fast"), Enum);
+	TestTrue(TEXT("Enum default resolves a qualified name"), Qualified.DefaultValue.IsSet() && *Qualified.DefaultValue == double(EKRollTestMode::Fast));
+	const FKRollTransform Numbered = Compile(EKRollValueKind::Enum, TEXT("1"), Enum);
+	TestTrue(TEXT("Enum default accepts a valid value"), Numbered.DefaultValue.IsSet() && *Numbered.DefaultValue == 1.0);
+	TestFalse(TEXT("Enum default rejects an unknown name"), Compile(EKRollValueKind::Enum, TEXT("Warp"), Enum).DefaultValue.IsSet());
+	TestFalse(TEXT("Enum default rejects an invalid value"), Compile(EKRollValueKind::Enum, TEXT("42"), Enum).DefaultValue.IsSet());
+
+	TestTrue(TEXT("String default is any text"), Compile(EKRollValueKind::String, TEXT("")).DefaultText.IsSet());
+	TestTrue(TEXT("Vector default is checked"), Compile(EKRollValueKind::Vector, TEXT("[1, 2, 3]")).DefaultText.IsSet());
+	TestFalse(TEXT("Short vector default is dropped"), Compile(EKRollValueKind::Vector, TEXT("[1, 2]")).DefaultText.IsSet());
+	TestTrue(TEXT("Hex color default is accepted"), Compile(EKRollValueKind::LinearColor, TEXT("#FF8000")).DefaultText.IsSet());
+	TestFalse(TEXT("Float array default must be numbers"), Compile(EKRollValueKind::FloatArray, TEXT("[1, \"x\"]")).DefaultText.IsSet());
+	return true;
+}
+
+#if WITH_METADATA
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKRollValueKindWriteTest, "KRoll.Bindings.ValueKinds", KROLL_TEST_FLAGS)
+
+bool FKRollValueKindWriteTest::RunTest(const FString& Parameters)
+{
+	const FKRollSnapshotPtr Snapshot = KRollTests::MakeSnapshot(TEXT(R"({
+		"tests.kinds.speed": 1.25,
+		"tests.kinds.flag": true,
+		"tests.kinds.big": 1099511627781,
+		"tests.kinds.ratio": 7,
+		"tests.kinds.tag": "Boss",
+		"tests.kinds.label": "hello",
+		"tests.kinds.offset": [1, 2, 3],
+		"tests.kinds.tint": {"r": 1, "g": 0.5, "b": 0.25, "a": 0.8},
+		"tests.kinds.curve": [0.5, 1.5]
+	})"));
+	if (!TestTrue(TEXT("Snapshot builds"), Snapshot.IsValid()))
+	{
+		return false;
+	}
+	UKRollSubsystem* KRoll = KRollTests::MakeSubsystem(Snapshot);
+
+	FKRollBindingCache Cache;
+	const FKRollClassBindings& Bindings = Cache.GetOrBuildActorBindings(AKRollValueKindTestActor::StaticClass());
+	AKRollValueKindTestActor* Actor = NewObject<AKRollValueKindTestActor>(GetTransientPackage());
+
+	const FKRollBindingPlan& Plan = Cache.GetOrBuildPlan(Bindings.ActorBindings, Actor, Actor, KRoll);
+	FKRollBindingApplier::ApplyPlan(Actor, Plan);
+
+	TestEqual(TEXT("Float"), Actor->Speed, 1.25f);
+	TestTrue(TEXT("Bool"), Actor->bFlag);
+	TestEqual(TEXT("Int64 beyond int32 range"), Actor->Big, int64(1099511627781));
+	TestEqual(TEXT("Double is scaled, then clamped"), Actor->Ratio, 10.0);
+	TestEqual(TEXT("Name"), Actor->Tag.ToString(), FString(TEXT("Boss")));
+	TestEqual(TEXT("String"), Actor->Label, FString(TEXT("hello")));
+	TestTrue(TEXT("Vector"), Actor->Offset.Equals(FVector(1.0, 2.0, 3.0)));
+	TestTrue(TEXT("Color RGB is scaled, alpha is not"), Actor->Tint.Equals(FLinearColor(0.5f, 0.25f, 0.125f, 0.8f)));
+	TestTrue(TEXT("Float array"), Actor->Curve == TArray<float>({ 0.5f, 1.5f }));
+
+	TestEqual(TEXT("Missing int falls back to KRollDefault"), Actor->Count, 7);
+	TestTrue(TEXT("Enum default is resolved by name"), Actor->Mode == EKRollTestMode::Fast);
+	TestTrue(TEXT("Invalid enum default leaves the property alone"), Actor->BadMode == EKRollTestMode::Turbo);
+
+	// Writing the same plan again keeps pooled values intact
+	FKRollBindingApplier::ApplyPlan(Actor, Plan);
+	TestEqual(TEXT("String is unchanged on reapply"), Actor->Label, FString(TEXT("hello")));
+	TestTrue(TEXT("Float array is unchanged on reapply"), Actor->Curve == TArray<float>({ 0.5f, 1.5f }));
+	return true;
+}
+#endif
+
+#endif